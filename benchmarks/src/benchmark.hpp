@@ -0,0 +1,39 @@
+#ifndef OCCA_BENCHMARKS_BENCHMARK_HEADER
+#define OCCA_BENCHMARKS_BENCHMARK_HEADER
+
+#include <occa.hpp>
+#include <occa/internal/utils/sys.hpp>
+
+namespace occa {
+  namespace benchmark {
+    // Runs func until at least minSeconds have passed
+    // Returns the average seconds per call
+    template <class func_t>
+    double timeIt(func_t func, const double minSeconds = 0.25) {
+      // Warm up
+      func();
+
+      int iterations = 0;
+      const double start = sys::currentTime();
+      double elapsed = 0;
+      do {
+        func();
+        ++iterations;
+        elapsed = sys::currentTime() - start;
+      } while (elapsed < minSeconds);
+
+      return elapsed / iterations;
+    }
+
+    // Results are printed as JSON to track regressions
+    inline void printResults(const std::string &benchmarkName,
+                             const occa::json &results) {
+      occa::json output;
+      output["benchmark"] = benchmarkName;
+      output["results"] = results;
+      std::cout << output << '\n';
+    }
+  }
+}
+
+#endif
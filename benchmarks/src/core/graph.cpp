@@ -0,0 +1,88 @@
+#include "benchmark.hpp"
+
+const std::string kernelSource = (
+  "@kernel void axpy(const int entries,\n"
+  "                  const float alpha,\n"
+  "                  const float *x,\n"
+  "                  float *y) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    y[i] += alpha * x[i];\n"
+  "  }\n"
+  "}\n"
+);
+
+occa::json graphResults(const std::string &mode,
+                        const int entries) {
+  occa::device device({
+    {"mode", mode}
+  });
+  occa::kernel axpy = device.buildKernelFromString(kernelSource, "axpy");
+
+  // Each chain of updates on one vector is independent from the others
+  const int vectorCount = 8;
+  const int chainLength = 5;
+  occa::memory x = device.malloc<float>(entries);
+  occa::memory y[vectorCount];
+  for (int i = 0; i < vectorCount; ++i) {
+    y[i] = device.malloc<float>(entries);
+  }
+
+  auto launchAll = [&]() {
+    for (int i = 0; i < vectorCount; ++i) {
+      for (int j = 0; j < chainLength; ++j) {
+        axpy(entries, 0.5f, x, y[i]);
+      }
+    }
+  };
+
+  const double launchSeconds = occa::benchmark::timeIt([&]() {
+    launchAll();
+    device.finish();
+  });
+
+  device.beginCapture({
+    {"concurrent", false}
+  });
+  launchAll();
+  occa::graph sequentialGraph = device.endCapture();
+
+  const double sequentialSeconds = occa::benchmark::timeIt([&]() {
+    sequentialGraph.replay();
+    device.finish();
+  });
+
+  device.beginCapture({
+    {"concurrent", true}
+  });
+  launchAll();
+  occa::graph concurrentGraph = device.endCapture();
+
+  const double concurrentSeconds = occa::benchmark::timeIt([&]() {
+    concurrentGraph.replay();
+    device.finish();
+  });
+
+  occa::json entry;
+  entry["mode"] = mode;
+  entry["entries"] = entries;
+  entry["kernels"] = vectorCount * chainLength;
+  entry["graph_depth"] = concurrentGraph.depth();
+  entry["launch_us"] = 1e6 * launchSeconds;
+  entry["sequential_replay_us"] = 1e6 * sequentialSeconds;
+  entry["concurrent_replay_us"] = 1e6 * concurrentSeconds;
+  entry["concurrent"] = concurrentGraph.isConcurrent();
+  return entry;
+}
+
+int main(const int argc, const char **argv) {
+  occa::json results;
+  results.asArray();
+
+  for (const int entries : {1 << 4, 1 << 16}) {
+    results += graphResults("Serial", entries);
+  }
+
+  occa::benchmark::printResults("core/graph", results);
+
+  return 0;
+}
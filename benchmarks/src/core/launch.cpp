@@ -0,0 +1,98 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "benchmark.hpp"
+
+// Count heap allocations made while launching
+static std::atomic<size_t> allocationCount(0);
+
+void* operator new(size_t bytes) {
+  ++allocationCount;
+  void *ptr = std::malloc(bytes ? bytes : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+// A kernel doing almost no work, so the time is spent launching it
+const std::string kernelSource = (
+  "@kernel void axpy(const int entries,\n"
+  "                  const float alpha,\n"
+  "                  const float *x,\n"
+  "                  float *y) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    y[i] += alpha * x[i];\n"
+  "  }\n"
+  "}\n"
+);
+
+occa::json launchResults(const std::string &mode) {
+  occa::device device({
+    {"mode", mode}
+  });
+
+  const int entries = 16;
+  occa::memory x = device.malloc<float>(entries);
+  occa::memory y = device.malloc<float>(entries);
+  occa::kernel axpy = device.buildKernelFromString(kernelSource, "axpy");
+
+  const int launches = 1000;
+  size_t allocations = 0;
+  const double seconds = occa::benchmark::timeIt([&]() {
+    const size_t startAllocations = allocationCount;
+    for (int i = 0; i < launches; ++i) {
+      axpy(entries, 0.5f, x, y);
+    }
+    allocations = allocationCount - startAllocations;
+  });
+  device.finish();
+
+  // Same launches with the arguments bound once
+  occa::boundKernel boundAxpy(axpy);
+  boundAxpy.bind("entries", entries);
+  boundAxpy.bind("x", x);
+  boundAxpy.bind("y", y);
+
+  size_t boundAllocations = 0;
+  const double boundSeconds = occa::benchmark::timeIt([&]() {
+    const size_t startAllocations = allocationCount;
+    for (int i = 0; i < launches; ++i) {
+      boundAxpy.bind("alpha", 0.5f);
+      boundAxpy.launch();
+    }
+    boundAllocations = allocationCount - startAllocations;
+  });
+  device.finish();
+
+  occa::json entry;
+  entry["mode"] = mode;
+  entry["ns_per_launch"] = 1e9 * seconds / launches;
+  entry["allocations_per_launch"] = (double) allocations / launches;
+  entry["bound_ns_per_launch"] = 1e9 * boundSeconds / launches;
+  entry["bound_allocations_per_launch"] = (double) boundAllocations / launches;
+  return entry;
+}
+
+int main(const int argc, const char **argv) {
+  occa::json results;
+  results.asArray();
+
+  results += launchResults("Serial");
+  if (occa::modeIsEnabled("OpenMP")) {
+    results += launchResults("OpenMP");
+  }
+
+  occa::benchmark::printResults("core/launch", results);
+
+  return 0;
+}
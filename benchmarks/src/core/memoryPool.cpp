@@ -0,0 +1,64 @@
+#include <random>
+#include <vector>
+
+#include "benchmark.hpp"
+
+// Keeps liveReservations small scratch reservations alive and replaces a
+// random one on every step, like a time-stepping code reusing a pool
+double reservationsPerSecond(occa::device &device,
+                             const std::string &allocator,
+                             const int liveReservations) {
+  occa::memoryPool memPool = device.createMemoryPool({
+    {"allocator", allocator}
+  });
+  memPool.setAlignment(64);
+  memPool.resize(liveReservations * 4096);
+
+  std::mt19937 generator(liveReservations);
+  std::uniform_int_distribution<int> entryDistribution(0, liveReservations - 1);
+  std::uniform_int_distribution<int> bytesDistribution(1, 2048);
+
+  std::vector<occa::memory> live(liveReservations);
+  for (int i = 0; i < liveReservations; ++i) {
+    live[i] = memPool.reserve<char>(bytesDistribution(generator));
+  }
+
+  const int steps = 1000;
+  const double seconds = occa::benchmark::timeIt([&]() {
+    for (int i = 0; i < steps; ++i) {
+      occa::memory &mem = live[entryDistribution(generator)];
+      mem.free();
+      mem = memPool.reserve<char>(bytesDistribution(generator));
+    }
+  });
+
+  live.clear();
+  memPool.free();
+
+  return steps / seconds;
+}
+
+int main(const int argc, const char **argv) {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  occa::json results;
+  results.asArray();
+
+  for (const int liveReservations : {100, 1000, 10000, 30000}) {
+    const double scanRate = reservationsPerSecond(device, "scan", liveReservations);
+    const double bestFitRate = reservationsPerSecond(device, "best_fit", liveReservations);
+
+    occa::json entry;
+    entry["live_reservations"] = liveReservations;
+    entry["scan_reserves_per_s"] = scanRate;
+    entry["best_fit_reserves_per_s"] = bestFitRate;
+    entry["speedup"] = bestFitRate / scanRate;
+    results += entry;
+  }
+
+  occa::benchmark::printResults("memoryPool", results);
+
+  return 0;
+}
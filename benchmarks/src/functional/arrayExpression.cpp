@@ -0,0 +1,58 @@
+#include <occa/functional.hpp>
+
+#include "benchmark.hpp"
+
+occa::json expressionResults(const std::string &mode,
+                             const int entries) {
+  occa::device device({
+    {"mode", mode}
+  });
+
+  occa::array<float> values(device, entries);
+  values.fill(1.5f);
+
+  auto square = OCCA_FUNCTION([](const float &value) -> float {
+    return value * value;
+  });
+  auto addOne = OCCA_FUNCTION([](const float &value) -> float {
+    return value + 1;
+  });
+
+  // a.map(f).map(g).sum() allocates two temporaries and reads memory three times
+  const double eagerSeconds = occa::benchmark::timeIt([&]() {
+    values.map(square).map(addOne).reduce<float>(
+      occa::reductionType::sum,
+      OCCA_FUNCTION([](const float &acc, const float &value) -> float {
+        return acc + value;
+      })
+    );
+  });
+
+  const double lazySeconds = occa::benchmark::timeIt([&]() {
+    values.lazy().map(square).map(addOne).sum();
+  });
+
+  occa::json entry;
+  entry["mode"] = mode;
+  entry["entries"] = entries;
+  entry["eager_ms"] = 1e3 * eagerSeconds;
+  entry["lazy_ms"] = 1e3 * lazySeconds;
+  entry["speedup"] = eagerSeconds / lazySeconds;
+  return entry;
+}
+
+int main(const int argc, const char **argv) {
+  occa::json results;
+  results.asArray();
+
+  for (const int entries : {1 << 16, 1 << 22}) {
+    results += expressionResults("Serial", entries);
+    if (occa::modeIsEnabled("OpenMP")) {
+      results += expressionResults("OpenMP", entries);
+    }
+  }
+
+  occa::benchmark::printResults("functional/arrayExpression", results);
+
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <occa/functional.hpp>
+
+#include "benchmark.hpp"
+
+occa::json primitiveResults(const std::string &mode,
+                            const int entries) {
+  occa::device device({
+    {"mode", mode}
+  });
+
+  std::vector<int> values(entries);
+  unsigned int seed = 1;
+  for (int i = 0; i < entries; ++i) {
+    seed = (1103515245 * seed) + 12345;
+    values[i] = (int) (seed >> 1);
+  }
+
+  occa::array<int> array(device, entries);
+  array.copyFrom(values.data());
+
+  std::vector<int> hostValues(entries);
+
+  const double stdSortSeconds = occa::benchmark::timeIt([&]() {
+    hostValues = values;
+    std::sort(hostValues.begin(), hostValues.end());
+  });
+
+  const double sortSeconds = occa::benchmark::timeIt([&]() {
+    array.sort();
+    device.finish();
+  });
+
+  const double stdScanSeconds = occa::benchmark::timeIt([&]() {
+    std::inclusive_scan(values.begin(), values.end(), hostValues.begin());
+  });
+
+  const double scanSeconds = occa::benchmark::timeIt([&]() {
+    array.inclusiveScan();
+    device.finish();
+  });
+
+  occa::json entry;
+  entry["mode"] = mode;
+  entry["entries"] = entries;
+  entry["std_sort_ms"] = 1e3 * stdSortSeconds;
+  entry["sort_ms"] = 1e3 * sortSeconds;
+  entry["std_inclusive_scan_ms"] = 1e3 * stdScanSeconds;
+  entry["inclusive_scan_ms"] = 1e3 * scanSeconds;
+  return entry;
+}
+
+int main(const int argc, const char **argv) {
+  occa::json results;
+  results.asArray();
+
+  for (const int entries : {1 << 16, 1 << 22}) {
+    results += primitiveResults("Serial", entries);
+    if (occa::modeIsEnabled("OpenMP")) {
+      results += primitiveResults("OpenMP", entries);
+    }
+  }
+
+  occa::benchmark::printResults("functional/primitives", results);
+
+  return 0;
+}
@@ -0,0 +1,168 @@
+#ifndef OCCA_BENCHMARKS_LANG_KERNELS_HEADER
+#define OCCA_BENCHMARKS_LANG_KERNELS_HEADER
+
+#include <utime.h>
+
+#include <occa/internal/io.hpp>
+#include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/sys.hpp>
+
+namespace occa {
+  namespace benchmark {
+    struct oklKernel_t {
+      std::string name;
+      std::string source;
+      occa::json props;
+    };
+
+    // A kernel with many statements, expressions and declarations
+    inline std::string makeLargeKernel(const int statements) {
+      std::string source = (
+        "@kernel void large(const int entries,\n"
+        "                   const float *a,\n"
+        "                   const float *b,\n"
+        "                   float *ab) {\n"
+        "  for (int group = 0; group < entries; group += 64; @outer) {\n"
+        "    @shared float cache[64];\n"
+        "    for (int id = group; id < group + 64; ++id; @inner) {\n"
+        "      float value = 0;\n"
+      );
+      for (int i = 0; i < statements; ++i) {
+        const std::string index = occa::toString(i);
+        source += (
+          "      const float v" + index + " = (a[id] * " + index + ".5f + b[id]) / (1 + (id % " + index + "3));\n"
+          "      if (v" + index + " > value) { value = v" + index + " * v" + index + "; }\n"
+        );
+      }
+      source += (
+        "      cache[id - group] = value;\n"
+        "      ab[id] = cache[id - group];\n"
+        "    }\n"
+        "  }\n"
+        "}\n"
+      );
+      return source;
+    }
+
+    // Every use of M<depth> expands through all the macros below it
+    inline std::string makeMacroKernel(const int depth,
+                                       const int uses) {
+      std::string source = "#define M0(x) ((x) * 2 + 1)\n";
+      for (int i = 1; i < depth; ++i) {
+        source += (
+          "#define M" + occa::toString(i) + "(x) "
+          "M" + occa::toString(i - 1) + "((x) + " + occa::toString(i) + ")\n"
+        );
+      }
+      const std::string lastMacro = "M" + occa::toString(depth - 1);
+
+      source += (
+        "@kernel void macros(const int entries, float *ab) {\n"
+        "  for (int i = 0; i < entries; ++i; @tile(64, @outer, @inner)) {\n"
+        "    float value = 0;\n"
+      );
+      for (int i = 0; i < uses; ++i) {
+        source += "    value += " + lastMacro + "(ab[i] + " + occa::toString(i) + ");\n";
+      }
+      source += (
+        "    ab[i] = value;\n"
+        "  }\n"
+        "}\n"
+      );
+      return source;
+    }
+
+    // Writes headers to directory and returns a kernel including all of them
+    //   Each header also includes a shared guarded header
+    inline std::string makeIncludeKernel(const std::string &directory,
+                                         const int headers) {
+      sys::mkpath(directory);
+
+      // Headers are old enough to be shared through the file cache
+      const auto writeHeader = [&](const std::string &filename,
+                                   const std::string &content) {
+        io::write(directory + filename, content);
+
+        struct utimbuf times;
+        times.actime = 1000;
+        times.modtime = 1000;
+        utime((directory + filename).c_str(), &times);
+      };
+
+      writeHeader(
+        "common.hpp",
+        "#ifndef BENCHMARK_COMMON_HPP\n"
+        "#define BENCHMARK_COMMON_HPP\n"
+        "#define SCALE(x) (2 * (x))\n"
+        "typedef float real_t;\n"
+        "#endif\n"
+      );
+
+      std::string source;
+      for (int i = 0; i < headers; ++i) {
+        const std::string index = occa::toString(i);
+        writeHeader(
+          "header" + index + ".hpp",
+          "#ifndef BENCHMARK_HEADER" + index + "_HPP\n"
+          "#define BENCHMARK_HEADER" + index + "_HPP\n"
+          "#include \"common.hpp\"\n"
+          "#define VALUE" + index + " SCALE(" + index + ")\n"
+          "real_t f" + index + "(const real_t x) {\n"
+          "  return x * VALUE" + index + ";\n"
+          "}\n"
+          "#endif\n"
+        );
+        source += "#include \"header" + index + ".hpp\"\n";
+      }
+
+      source += (
+        "@kernel void includes(const int entries, real_t *ab) {\n"
+        "  for (int i = 0; i < entries; ++i; @tile(64, @outer, @inner)) {\n"
+        "    real_t value = 0;\n"
+      );
+      for (int i = 0; i < headers; ++i) {
+        source += "    value += f" + occa::toString(i) + "(ab[i]);\n";
+      }
+      source += (
+        "    ab[i] = value;\n"
+        "  }\n"
+        "}\n"
+      );
+      return source;
+    }
+
+    // Example kernels with the defines their main.cpp passes in
+    inline std::vector<oklKernel_t> getExampleKernels() {
+      std::vector<oklKernel_t> kernels;
+
+      const auto addKernel = [&](const std::string &filename,
+                                 const occa::json &defines) {
+        oklKernel_t kernel;
+        kernel.name = filename;
+        kernel.source = io::read(env::OCCA_DIR + "examples/cpp/" + filename);
+        kernel.props["defines"] = defines;
+        kernels.push_back(kernel);
+      };
+
+      addKernel("01_add_vectors/addVectors.okl",
+                occa::json());
+      addKernel("06_shared_memory/reduction.okl",
+                {{"block", 256}});
+      addKernel("15_finite_difference/fd2d.okl",
+                {{"tFloat", "float"},
+                 {"sr", 2}, {"w", 1000}, {"h", 1000},
+                 {"dx", 0.1}, {"dt", 0.01}, {"freq", 1.5},
+                 {"mX", 500}, {"mY", 500}, {"Bx", 16}, {"By", 16}});
+      addKernel("16_mandelbulb/rayMarcher.okl",
+                {{"WIDTH", 640}, {"HEIGHT", 480}, {"BATCH_SIZE", 16},
+                 {"SHAPE_FUNCTION", "mandelbulb"},
+                 {"PIXEL", 0.01}, {"HALF_PIXEL", 0.005}});
+      addKernel("18_nonblocking_streams/powerOfPi.okl",
+                {{"block", 256}, {"group", 4}});
+
+      return kernels;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,81 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <occa/internal/io.hpp>
+#include <occa/internal/utils/env.hpp>
+#include <occa/internal/lang/modes/serial.hpp>
+
+#include "benchmark.hpp"
+#include "lang/kernels.hpp"
+
+// Count every heap allocation made while translating
+static std::atomic<size_t> allocationCount(0);
+
+void* operator new(size_t bytes) {
+  ++allocationCount;
+  void *ptr = std::malloc(bytes ? bytes : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+int main(const int argc, const char **argv) {
+  std::vector<std::string> names;
+  std::vector<std::string> sources;
+
+  for (const char *kernel : {"addVectors.okl", "argKernel.okl"}) {
+    names.push_back(kernel);
+    sources.push_back(occa::io::read(occa::env::OCCA_DIR + "tests/files/" + kernel));
+  }
+  for (const char *kernel : {"16_mandelbulb/rayMarcher.okl",
+                                    "06_shared_memory/reduction.okl"}) {
+    names.push_back(kernel);
+    // The examples define their tile sizes through kernel props
+    sources.push_back(
+      "#define block 256\n"
+      + occa::io::read(occa::env::OCCA_DIR + "examples/cpp/" + kernel)
+    );
+  }
+  names.push_back("large");
+  sources.push_back(occa::benchmark::makeLargeKernel(500));
+
+  occa::json results;
+  results.asArray();
+
+  const int kernelCount = (int) sources.size();
+  for (int i = 0; i < kernelCount; ++i) {
+    const std::string &source = sources[i];
+    occa::lang::okl::serialParser parser;
+
+    std::string output;
+    size_t allocations = 0;
+    const double seconds = occa::benchmark::timeIt([&]() {
+      const size_t startCount = allocationCount;
+      parser.parseSource(source);
+      output = parser.toString();
+      allocations = allocationCount - startCount;
+    });
+
+    occa::json entry;
+    entry["kernel"] = names[i];
+    entry["bytes"] = (int) source.size();
+    entry["succeeded"] = parser.succeeded();
+    entry["ms_per_translation"] = 1e3 * seconds;
+    entry["allocations_per_translation"] = (double) allocations;
+    results += entry;
+  }
+
+  occa::benchmark::printResults("lang/parser", results);
+
+  return 0;
+}
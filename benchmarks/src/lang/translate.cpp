@@ -0,0 +1,262 @@
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+#include <occa/internal/io.hpp>
+#include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/sys.hpp>
+#include <occa/internal/lang/arena.hpp>
+#include <occa/internal/lang/modes/cuda.hpp>
+#include <occa/internal/lang/modes/dpcpp.hpp>
+#include <occa/internal/lang/modes/hip.hpp>
+#include <occa/internal/lang/modes/metal.hpp>
+#include <occa/internal/lang/modes/opencl.hpp>
+#include <occa/internal/lang/modes/openmp.hpp>
+#include <occa/internal/lang/modes/serial.hpp>
+#include <occa/internal/lang/modes/threads.hpp>
+
+#include "benchmark.hpp"
+#include "lang/kernels.hpp"
+
+// Track live heap bytes to report the peak memory of each translation
+//   The size is stored in front of each allocation
+//   Tokens and nodes recycled by the lang arena don't go through operator new,
+//   so the arena's own counters are reported next to these
+static const size_t headerBytes = alignof(std::max_align_t);
+static std::atomic<size_t> liveBytes(0);
+static std::atomic<size_t> peakBytes(0);
+static std::atomic<size_t> allocationCount(0);
+
+void* operator new(size_t bytes) {
+  char *ptr = (char*) std::malloc(headerBytes + bytes);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  *((size_t*) ptr) = bytes;
+
+  ++allocationCount;
+  const size_t live = (liveBytes += bytes);
+  size_t peak = peakBytes;
+  while ((live > peak) && !peakBytes.compare_exchange_weak(peak, live)) {}
+
+  return ptr + headerBytes;
+}
+
+void operator delete(void *ptr) noexcept {
+  if (!ptr) {
+    return;
+  }
+  char *start = ((char*) ptr) - headerBytes;
+  liveBytes -= *((size_t*) start);
+  std::free(start);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  operator delete(ptr);
+}
+
+// Times the mode passes run in afterParsing()
+template <class parserType>
+class timedParser : public parserType {
+ public:
+  double afterParsingSeconds;
+
+  timedParser(const occa::json &settings_) :
+    parserType(settings_),
+    afterParsingSeconds(0) {}
+
+  virtual void afterParsing() {
+    const double start = occa::sys::currentTime();
+    parserType::afterParsing();
+    afterParsingSeconds = occa::sys::currentTime() - start;
+  }
+};
+
+struct stageTimes_t {
+  double setup;
+  double tokenize;
+  double preprocess;
+  double parse;
+  double transform;
+  double print;
+
+  stageTimes_t() :
+    setup(0),
+    tokenize(0),
+    preprocess(0),
+    parse(0),
+    transform(0),
+    print(0) {}
+
+  double total() const {
+    return setup + tokenize + preprocess + parse + transform + print;
+  }
+};
+
+struct translation_t {
+  bool succeeded;
+  stageTimes_t times;
+};
+
+typedef std::function<translation_t (const occa::benchmark::oklKernel_t &kernel)> translator_t;
+
+// Lexes the source on its own since tokenizing and preprocessing
+//   are streamed together when parsing
+double timeTokenizer(const std::string &source) {
+  const double start = occa::sys::currentTime();
+  occa::lang::tokenizer_t tokenizer(source.c_str());
+  occa::lang::token_t *token;
+  while (!tokenizer.isEmpty()) {
+    tokenizer >> token;
+    delete token;
+  }
+  return occa::sys::currentTime() - start;
+}
+
+std::string getLauncherSource(occa::lang::parser_t &) {
+  return "";
+}
+
+std::string getLauncherSource(occa::lang::okl::withLauncher &parser) {
+  return parser.launcherParser.toString();
+}
+
+template <class parserType>
+translation_t translate(const occa::benchmark::oklKernel_t &kernel) {
+  translation_t translation;
+  stageTimes_t &times = translation.times;
+
+  double start = occa::sys::currentTime();
+  timedParser<parserType> parser(kernel.props);
+  times.setup = occa::sys::currentTime() - start;
+
+  times.tokenize = timeTokenizer(kernel.source);
+
+  start = occa::sys::currentTime();
+  parser.setSource(kernel.source, false);
+  // Includes lexing the source and loading included files
+  times.preprocess = std::max(0.0, occa::sys::currentTime() - start - times.tokenize);
+
+  if (parser.success) {
+    start = occa::sys::currentTime();
+    parser.parseTokens();
+    times.parse = occa::sys::currentTime() - start - parser.afterParsingSeconds;
+    times.transform = parser.afterParsingSeconds;
+  }
+
+  translation.succeeded = parser.succeeded();
+  if (translation.succeeded) {
+    start = occa::sys::currentTime();
+    const std::string output = parser.toString() + getLauncherSource(parser);
+    times.print = occa::sys::currentTime() - start;
+  }
+
+  return translation;
+}
+
+int main(const int argc, const char **argv) {
+  using namespace occa::lang::okl;
+
+  const std::string includeDirectory = occa::env::OCCA_CACHE_DIR + "benchmarks/lang/translate/";
+
+  std::vector<occa::benchmark::oklKernel_t> kernels = occa::benchmark::getExampleKernels();
+  {
+    occa::benchmark::oklKernel_t kernel;
+
+    kernel.name = "statements";
+    kernel.source = occa::benchmark::makeLargeKernel(1000);
+    kernels.push_back(kernel);
+
+    kernel.name = "macros";
+    kernel.source = occa::benchmark::makeMacroKernel(64, 100);
+    kernels.push_back(kernel);
+
+    kernel.name = "includes";
+    kernel.source = occa::benchmark::makeIncludeKernel(includeDirectory, 100);
+    kernel.props["okl/include_paths"] = occa::json::parse("[]");
+    kernel.props["okl/include_paths"] += includeDirectory;
+    kernels.push_back(kernel);
+  }
+
+  std::vector<std::pair<std::string, translator_t>> modes = {
+    {"serial", translate<serialParser>},
+    {"openmp", translate<openmpParser>},
+    {"threads", translate<threadsParser>},
+    {"cuda", translate<cudaParser>},
+    {"hip", translate<hipParser>},
+    {"opencl", translate<openclParser>},
+    {"metal", translate<metalParser>},
+    {"dpcpp", translate<dpcppParser>},
+  };
+
+  occa::json results;
+  results.asArray();
+
+  for (const occa::benchmark::oklKernel_t &kernel : kernels) {
+    for (auto &mode : modes) {
+      bool succeeded = true;
+      stageTimes_t times;
+      int translations = 0;
+      size_t peak = 0;
+      size_t allocations = 0;
+      size_t arenaPeak = 0;
+      size_t arenaAllocations = 0;
+
+      occa::benchmark::timeIt([&]() {
+        const size_t startBytes = liveBytes;
+        const size_t startAllocations = allocationCount;
+        peakBytes = startBytes;
+
+        occa::lang::arena::resetThreadPeak();
+        const occa::lang::arena::threadStats_t startArena = occa::lang::arena::threadStats();
+
+        const translation_t translation = mode.second(kernel);
+
+        peak = std::max(peak, peakBytes - startBytes);
+        allocations = allocationCount - startAllocations;
+
+        const occa::lang::arena::threadStats_t arena = occa::lang::arena::threadStats();
+        arenaPeak = std::max(arenaPeak, arena.peakBytes - startArena.liveBytes);
+        arenaAllocations = arena.allocations - startArena.allocations;
+        succeeded &= translation.succeeded;
+
+        // Skip the warm up
+        if (translations++) {
+          times.setup      += translation.times.setup;
+          times.tokenize   += translation.times.tokenize;
+          times.preprocess += translation.times.preprocess;
+          times.parse      += translation.times.parse;
+          times.transform  += translation.times.transform;
+          times.print      += translation.times.print;
+        }
+      });
+      const double scale = 1e3 / (translations - 1);
+
+      occa::json entry;
+      entry["kernel"] = kernel.name;
+      entry["mode"] = mode.first;
+      entry["bytes"] = (int) kernel.source.size();
+      entry["succeeded"] = succeeded;
+      entry["ms_per_translation"] = scale * times.total();
+      entry["setup_ms"] = scale * times.setup;
+      entry["tokenize_ms"] = scale * times.tokenize;
+      entry["preprocess_ms"] = scale * times.preprocess;
+      entry["parse_ms"] = scale * times.parse;
+      entry["transform_ms"] = scale * times.transform;
+      entry["print_ms"] = scale * times.print;
+      entry["peak_bytes"] = (double) peak;
+      entry["allocations_per_translation"] = (double) allocations;
+      entry["arena_peak_bytes"] = (double) arenaPeak;
+      entry["arena_allocations_per_translation"] = (double) arenaAllocations;
+      entry["arena_reserved_bytes"] = (double) occa::lang::arena::reservedBytes();
+      results += entry;
+    }
+  }
+
+  occa::sys::rmrf(includeDirectory);
+
+  occa::benchmark::printResults("lang/translate", results);
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include <string>
+
+#include "benchmark.hpp"
+
+// Roughly the shape of the properties passed through malloc, buildKernel and stream creation
+occa::json makeProperties(const int extraKeys) {
+  occa::json props({
+    {"mode", "Serial"},
+    {"device_id", 0},
+    {"kernel", {
+      {"compiler", "g++"},
+      {"compiler_flags", "-O3 -march=native"},
+      {"compiler_env_script", ""},
+      {"verbose", false},
+      {"okl", {
+        {"enabled", true},
+        {"validate", true}
+      }}
+    }},
+    {"memory", {
+      {"use_host_pointer", false},
+      {"thread_cache", true}
+    }},
+    {"stream", {
+      {"async", true}
+    }}
+  });
+
+  for (int i = 0; i < extraKeys; ++i) {
+    const std::string index = std::to_string(i);
+    props["defines/DEFINE_" + index] = i;
+    props["kernel/arguments/arg" + index] = "float*";
+  }
+  return props;
+}
+
+int main(const int argc, const char **argv) {
+  occa::json results;
+  results.asArray();
+
+  for (const int extraKeys : {0, 16, 256}) {
+    const occa::json props = makeProperties(extraKeys);
+    const occa::json overrides({
+      {"kernel", {
+        {"compiler_flags", "-O2"},
+        {"okl", {{"validate", false}}}
+      }},
+      {"memory/thread_cache", false}
+    });
+    const std::string source = props.dump(0);
+
+    occa::json parsed;
+    const double parseSeconds = occa::benchmark::timeIt([&]() {
+      parsed = occa::json::parse(source);
+    });
+
+    occa::json copied;
+    const double copySeconds = occa::benchmark::timeIt([&]() {
+      copied = props;
+    });
+
+    occa::json merged;
+    const double mergeSeconds = occa::benchmark::timeIt([&]() {
+      merged = props + overrides;
+    });
+
+    // Mix of hits and misses, the way modes query optional properties
+    int found = 0;
+    const double lookupSeconds = occa::benchmark::timeIt([&]() {
+      found += props.get<bool>("kernel/okl/validate");
+      found += props.get<int>("device_id", 1);
+      found += props.get<bool>("memory/use_host_pointer");
+      found += props.get<std::string>("kernel/compiler").size();
+      found += props.has("kernel/include_occa");
+      found += props["stream/async"].isBool();
+      found += props.get<int>("defines/DEFINE_0", -1);
+      found += props.has("missing/path");
+    });
+
+    occa::json entry;
+    entry["keys"] = extraKeys;
+    entry["bytes"] = (int) source.size();
+    entry["parse_mb_per_s"] = (source.size() / (1024.0 * 1024.0)) / parseSeconds;
+    entry["copies_per_s"] = 1.0 / copySeconds;
+    entry["merges_per_s"] = 1.0 / mergeSeconds;
+    entry["lookups_per_s"] = 8.0 / lookupSeconds;
+    entry["checksum"] = found + parsed.size() + copied.size() + merged.size();
+    results += entry;
+  }
+
+  occa::json summary;
+  summary["sizeof_json"] = (int) sizeof(occa::json);
+  summary["runs"] = results;
+
+  occa::benchmark::printResults("json", summary);
+
+  return 0;
+}
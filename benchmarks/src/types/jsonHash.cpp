@@ -0,0 +1,67 @@
+#include <string>
+
+#include "benchmark.hpp"
+
+// Hash computed by serializing the tree first, used before OCCA_CACHE_VERSION 3
+occa::hash_t legacyHash(const occa::json &j) {
+  std::string out;
+  j.dumpToString(out);
+  return occa::hash(out);
+}
+
+// Kernel properties after merging device defaults with per-build defines and headers
+occa::json makeKernelProperties(const int defineCount) {
+  occa::json props({
+    {"mode", "Serial"},
+    {"compiler", "g++"},
+    {"compiler_flags", "-O3 -march=native -fopenmp"},
+    {"compiler_env_script", ""},
+    {"compiler_linker_flags", "-lm"},
+    {"compiler_vendor", 1},
+    {"verbose", false},
+    {"okl", {
+      {"enabled", true},
+      {"validate", true},
+      {"include_paths", occa::jsonArray({"/opt/app/include", "/opt/app/okl"})}
+    }},
+    {"serial", {
+      {"include_std", true}
+    }}
+  });
+
+  for (int i = 0; i < defineCount; ++i) {
+    props["defines/APP_DEFINE_" + std::to_string(i)] = i;
+  }
+  props["includes"] = occa::jsonArray({"constants.hpp", "math.hpp"});
+  props["headers"] = occa::jsonArray({"#define BLOCK_SIZE 256"});
+  props["functions"].asObject();
+  return props;
+}
+
+int main(const int argc, const char **argv) {
+  occa::json results;
+  results.asArray();
+
+  for (const int defineCount : {0, 8, 64, 512}) {
+    const occa::json props = makeKernelProperties(defineCount);
+
+    occa::hash_t legacyResult, result;
+    const double legacySeconds = occa::benchmark::timeIt([&]() {
+      legacyResult ^= legacyHash(props);
+    });
+    const double seconds = occa::benchmark::timeIt([&]() {
+      result ^= props.hash();
+    });
+
+    occa::json entry;
+    entry["defines"] = defineCount;
+    entry["legacy_hashes_per_s"] = 1.0 / legacySeconds;
+    entry["hashes_per_s"] = 1.0 / seconds;
+    entry["speedup"] = legacySeconds / seconds;
+    results += entry;
+  }
+
+  occa::benchmark::printResults("jsonHash", results);
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include <vector>
+
+#include <occa/internal/utils/hash.hpp>
+
+#include "benchmark.hpp"
+
+// Byte-at-a-time hash used before OCCA_CACHE_VERSION 2, kept for comparison
+occa::hash_t legacyHash(const void *ptr, occa::udim_t bytes) {
+  const char *c = (const char*) ptr;
+
+  occa::hash_t hash;
+  int *h = hash.h;
+
+  const int p[8] = {
+    102679, 102701, 102761, 102763,
+    102769, 102793, 102797, 102811
+  };
+
+  for (occa::udim_t i = 0; i < bytes; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      h[j] = (h[j] * p[j]) ^ c[i];
+    }
+  }
+  hash.initialized = true;
+
+  return hash;
+}
+
+int main(const int argc, const char **argv) {
+  occa::json results;
+  results.asArray();
+
+  // Small json keys, kernel sources and large headers
+  for (const int bytes : {16, 256, 4 * 1024, 64 * 1024, 1024 * 1024}) {
+    std::vector<char> data(bytes);
+    for (int i = 0; i < bytes; ++i) {
+      data[i] = (char) (i * 31 + 7);
+    }
+
+    occa::hash_t legacyResult, result;
+    const double legacySeconds = occa::benchmark::timeIt([&]() {
+      legacyResult ^= legacyHash(data.data(), bytes);
+    });
+    const double seconds = occa::benchmark::timeIt([&]() {
+      result ^= occa::hash(data.data(), bytes);
+    });
+
+    const double megabytes = bytes / (1024.0 * 1024.0);
+
+    occa::json entry;
+    entry["bytes"] = bytes;
+    entry["legacy_mb_per_s"] = megabytes / legacySeconds;
+    entry["mb_per_s"] = megabytes / seconds;
+    entry["speedup"] = legacySeconds / seconds;
+    results += entry;
+  }
+
+  occa::benchmark::printResults("hash", results);
+
+  return 0;
+}
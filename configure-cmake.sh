@@ -22,9 +22,11 @@
 : ${OCCA_ENABLE_HIP="ON"}
 : ${OCCA_ENABLE_OPENMP="ON"}
 : ${OCCA_ENABLE_METAL="ON"}
+: ${OCCA_ENABLE_CLANG_JIT="OFF"}
 : ${OCCA_ENABLE_FORTRAN="OFF"}
 : ${OCCA_ENABLE_TESTS="ON"}
 : ${OCCA_ENABLE_EXAMPLES="ON"}
+: ${OCCA_ENABLE_BENCHMARKS="OFF"}
 
 cmake -S . -B ${BUILD_DIR} \
   -DCMAKE_BUILD_TYPE=${BUILD_TYPE} \
@@ -41,6 +43,8 @@ cmake -S . -B ${BUILD_DIR} \
   -DOCCA_ENABLE_CUDA=${OCCA_ENABLE_CUDA} \
   -DOCCA_ENABLE_HIP=${OCCA_ENABLE_HIP} \
   -DOCCA_ENABLE_METAL=${OCCA_ENABLE_METAL} \
+  -DOCCA_ENABLE_CLANG_JIT=${OCCA_ENABLE_CLANG_JIT} \
   -DOCCA_ENABLE_FORTRAN=${OCCA_ENABLE_FORTRAN} \
   -DOCCA_ENABLE_TESTS=${OCCA_ENABLE_TESTS} \
-  -DOCCA_ENABLE_EXAMPLES=${OCCA_ENABLE_EXAMPLES}
+  -DOCCA_ENABLE_EXAMPLES=${OCCA_ENABLE_EXAMPLES} \
+  -DOCCA_ENABLE_BENCHMARKS=${OCCA_ENABLE_BENCHMARKS}
@@ -55,6 +55,28 @@ void occaKernelRunWithArgs(occaKernel kernel,
                            const int argc,
                            occaType *args);
 
+//---[ Bound Kernel ]-------------------
+occaBoundKernel occaCreateBoundKernel(occaKernel kernel);
+
+int occaBoundKernelArgumentIndex(occaBoundKernel boundKernel,
+                                 const char *name);
+
+void occaBoundKernelBindArg(occaBoundKernel boundKernel,
+                            const int index,
+                            occaType arg);
+
+void occaBoundKernelBindNamedArg(occaBoundKernel boundKernel,
+                                 const char *name,
+                                 occaType arg);
+
+// Binds args[0], ..., args[argc - 1] to the first argc arguments
+void occaBoundKernelBindArgs(occaBoundKernel boundKernel,
+                             const int argc,
+                             occaType *args);
+
+void occaBoundKernelLaunch(occaBoundKernel boundKernel);
+//======================================
+
 OCCA_END_EXTERN_C
 
 #endif
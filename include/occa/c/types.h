@@ -42,6 +42,7 @@ typedef struct {
 
 typedef occaType occaDevice;
 typedef occaType occaKernel;
+typedef occaType occaBoundKernel;
 typedef occaType occaKernelBuilder;
 typedef occaType occaMemory;
 typedef occaType occaMemoryPool;
@@ -85,6 +86,8 @@ extern const int OCCA_STREAMTAG;
 extern const int OCCA_DTYPE;
 extern const int OCCA_SCOPE;
 extern const int OCCA_JSON;
+
+extern const int OCCA_BOUNDKERNEL;
 //======================================
 
 //---[ Globals & Flags ]----------------
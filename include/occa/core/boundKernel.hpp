@@ -0,0 +1,134 @@
+#ifndef OCCA_CORE_BOUNDKERNEL_HEADER
+#define OCCA_CORE_BOUNDKERNEL_HEADER
+
+#include <string>
+#include <vector>
+
+#include <occa/core/kernel.hpp>
+#include <occa/core/memory.hpp>
+
+namespace occa {
+  /**
+   * @startDoc{boundKernel}
+   *
+   * Description:
+   *   A [[kernel]] launch whose arguments are bound once and replayed.
+   *
+   *   Arguments are checked against the kernel when they're bound, so
+   *   [[boundKernel.launch]] skips the argument setup and validation done
+   *   by [[kernel.run]].
+   *   Scalars can be rebound in place between launches without allocating.
+   *   Bound [[memory]] is referenced until it's rebound or the [[boundKernel]] is destroyed.
+   *
+   *   ```cpp
+   *   occa::boundKernel step(addVectors);
+   *   step.bind("a", o_a);
+   *   step.bind("b", o_b);
+   *   step.bind("ab", o_ab);
+   *   for (int i = 0; i < steps; ++i) {
+   *     step.bind("entries", entries[i]);
+   *     step.launch();
+   *   }
+   *   ```
+   *
+   * @endDoc
+   */
+  class boundKernel {
+  private:
+    occa::kernel kernel_;
+    std::vector<kernelArgData> arguments;
+    // Keeps bound memory alive after the caller's wrappers are gone
+    std::vector<occa::memory> memoryRefs;
+    std::vector<bool> isBound;
+    int boundCount;
+
+  public:
+    boundKernel();
+    boundKernel(const occa::kernel &kernel__);
+
+  private:
+    void assertInitialized() const;
+
+  public:
+    /**
+     * @startDoc{isInitialized}
+     *
+     * Description:
+     *   Check whether the [[boundKernel]] was created from an initialized [[kernel]].
+     *
+     * @endDoc
+     */
+    bool isInitialized() const;
+
+    /**
+     * @startDoc{getKernel}
+     *
+     * Description:
+     *   Returns the [[kernel]] being launched.
+     *
+     * @endDoc
+     */
+    occa::kernel getKernel() const;
+
+    /**
+     * @startDoc{argumentCount}
+     *
+     * Description:
+     *   Returns the number of arguments the [[kernel]] takes, or the number of
+     *   arguments bound so far if the kernel doesn't have source metadata.
+     *
+     * @endDoc
+     */
+    int argumentCount() const;
+
+    /**
+     * @startDoc{argumentIndex}
+     *
+     * Description:
+     *   Returns the position of the kernel argument named `name`, or `-1` if
+     *   the kernel doesn't have an argument with that name.
+     *
+     * @endDoc
+     */
+    int argumentIndex(const std::string &name) const;
+
+    /**
+     * @startDoc{bind}
+     *
+     * Description:
+     *   Binds a single value to the kernel argument at position `index`, or
+     *   named `name`.
+     *   Arguments can be rebound at any time, for example to update scalars
+     *   between launches.
+     *
+     * Arguments:
+     *   index:
+     *     Position of the argument, starting at 0.
+     *
+     *   name:
+     *     Name of the argument in the kernel source.
+     *
+     *   arg:
+     *     An [[memory]] or a scalar value.
+     *
+     * @endDoc
+     */
+    void bind(const int index, const kernelArg &arg);
+    void bind(const std::string &name, const kernelArg &arg);
+
+    /**
+     * @startDoc{launch}
+     *
+     * Description:
+     *   Launches the [[kernel]] with the bound arguments.
+     *
+     *   Every argument needs to be bound.
+     *   The launch doesn't change the arguments set on the [[kernel]] itself.
+     *
+     * @endDoc
+     */
+    void launch();
+  };
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include <occa/core/kernel.hpp>
 #include <occa/core/memory.hpp>
 #include <occa/core/memoryPool.hpp>
+#include <occa/core/resolvedProperties.hpp>
 #include <occa/core/stream.hpp>
 #include <occa/defines.hpp>
 #include <occa/dtype.hpp>
@@ -19,12 +20,30 @@ namespace occa {
   class modeKernel_t; class kernel;
   class modeDevice_t; class device;
   class modeStreamTag_t; class streamTag;
+  class modeGraph_t; class graph;
   class deviceInfo;
 
   typedef std::map<std::string, kernel>   cachedKernelMap;
   typedef cachedKernelMap::iterator       cachedKernelMapIterator;
   typedef cachedKernelMap::const_iterator cCachedKernelMapIterator;
 
+  /**
+   * @startDoc{kernelBuildInfo}
+   *
+   * Description:
+   *   Arguments for a single [[device.buildKernel]] call, used by [[device.buildKernels]].
+   *
+   * @endDoc
+   */
+  struct kernelBuildInfo {
+    std::string filename;
+    std::string kernelName;
+    occa::json props;
+  };
+
+  typedef std::vector<kernelBuildInfo> kernelBuildInfoVector;
+  typedef std::vector<kernel>          kernelVector;
+
   /**
    * @startDoc{device}
    *
@@ -173,6 +192,21 @@ namespace occa {
     void setModeDevice(modeDevice_t *modeDevice_);
     void removeDeviceRef();
 
+    occa::memory mallocWithProperties(const dim_t entries,
+                                      const dtype_t &dtype,
+                                      const void *src,
+                                      const occa::json &memProps);
+
+    occa::kernel buildKernelWithProperties(const std::string &filename,
+                                           const std::string &kernelName,
+                                           const occa::json &kernelProps,
+                                           const hash_t &propsHash) const;
+
+    occa::kernel buildKernelFromStringWithProperties(const std::string &content,
+                                                     const std::string &kernelName,
+                                                     const occa::json &kernelProps,
+                                                     const hash_t &propsHash) const;
+
   public:
     /**
      * @startDoc{dontUseRefs}
@@ -306,6 +340,49 @@ namespace occa {
     const occa::json& streamProperties() const;
     occa::json streamProperties(const occa::json &additionalProps) const;
 
+    /**
+     * @startDoc{resolveMemoryProperties}
+     *
+     * Description:
+     *   Merge `props` with the device's memory properties once, for repeated
+     *   [[device.malloc]] calls.
+     *
+     * Returns:
+     *   The [[resolvedProperties]] for this device
+     *
+     * @endDoc
+     */
+    resolvedProperties resolveMemoryProperties(const occa::json &props = occa::json()) const;
+
+    /**
+     * @startDoc{resolveKernelProperties}
+     *
+     * Description:
+     *   Merge `props` with the device's kernel properties once, for repeated
+     *   [[device.buildKernel]] calls.
+     *   The device and kernel header parts of the kernel hash are also computed once.
+     *
+     * Returns:
+     *   The [[resolvedProperties]] for this device
+     *
+     * @endDoc
+     */
+    resolvedProperties resolveKernelProperties(const occa::json &props = occa::json()) const;
+
+    /**
+     * @startDoc{resolveStreamProperties}
+     *
+     * Description:
+     *   Merge `props` with the device's stream properties once, for repeated
+     *   [[device.createStream]] calls.
+     *
+     * Returns:
+     *   The [[resolvedProperties]] for this device
+     *
+     * @endDoc
+     */
+    resolvedProperties resolveStreamProperties(const occa::json &props = occa::json()) const;
+
     /**
      * @startDoc{hash}
      *
@@ -361,6 +438,32 @@ namespace occa {
      */
     udim_t maxMemoryAllocated() const;
 
+    /**
+     * @startDoc{kernelCacheHits}
+     *
+     * Description:
+     *   Find how many [[device.buildKernel]] calls returned an already-loaded [[kernel]].
+     *
+     * Returns:
+     *   The number of in-memory kernel cache hits.
+     *
+     * @endDoc
+     */
+    udim_t kernelCacheHits() const;
+
+    /**
+     * @startDoc{kernelCacheMisses}
+     *
+     * Description:
+     *   Find how many [[device.buildKernel]] calls had to load or compile a new [[kernel]].
+     *
+     * Returns:
+     *   The number of in-memory kernel cache misses.
+     *
+     * @endDoc
+     */
+    udim_t kernelCacheMisses() const;
+
     /**
      * @startDoc{finish}
      *
@@ -419,6 +522,11 @@ namespace occa {
      */
     stream createStream(const occa::json &props = occa::json());
 
+    /**
+     * @doc{createStream}
+     */
+    stream createStream(const resolvedProperties &props);
+
     /**
      * @startDoc{wrapStream}
      *
@@ -464,8 +572,11 @@ namespace occa {
      * Description:
      *   Tag the active stream and return the created [[streamTag]].
      *
+     *   While capturing a [[graph]] the tag is only recorded in the graph.
+     *   The tag created on each replay is found in [[graph.tags]].
+     *
      * Returns:
-     *   The created [[streamTag]].
+     *   The created [[streamTag]], or an uninitialized one while capturing.
      *
      * @endDoc
      */
@@ -496,12 +607,75 @@ namespace occa {
                        const streamTag &endTag);
     //  |===============================
 
+    //  |---[ Graph ]-------------------
+    /**
+     * @startDoc{beginCapture}
+     *
+     * Description:
+     *   Starts recording kernel launches, memory copies and [[stream tags|device.tagStream]]
+     *   into a [[graph]] instead of running them.
+     *   Other calls, such as allocations, still run right away.
+     *
+     *   Recorded operations keep the [[stream]] they were issued on.
+     *   Host pointers passed to recorded copies are read or written when the graph is replayed.
+     *
+     * Arguments:
+     *   props:
+     *     Graph properties
+     *
+     *     - `concurrent` (bool): Run independent operations concurrently on replay.
+     *       Only supported when every operation is on the same stream.
+     *       Defaults to `false`.
+     *
+     *   # Dependencies
+     *
+     *   Two recorded operations depend on each other when they access the same allocation
+     *   and at least one of them writes to it. The later one then waits for the earlier one.
+     *
+     *   - Slices of an allocation count as the whole allocation.
+     *   - Kernel [[memory]] arguments are writes unless the kernel declares them `const`.
+     *   - All host pointers count as a single allocation.
+     *   - Launches of a kernel that isn't reentrant depend on each other.
+     *   - [[Stream tags|device.tagStream]] wait for every operation before them, and every later operation waits for them.
+     *
+     *   Memory a kernel reaches in other ways isn't tracked. Examples are pointers stored inside
+     *   other buffers or structs, and host pointers captured by the kernel.
+     *   Only use `concurrent: true` when every access goes through the recorded arguments.
+     *
+     * @endDoc
+     */
+    void beginCapture(const occa::json &props = occa::json());
+
+    /**
+     * @startDoc{endCapture}
+     *
+     * Description:
+     *   Stops recording and returns the recorded [[graph]].
+     *
+     * @endDoc
+     */
+    graph endCapture();
+
+    /**
+     * @startDoc{isCapturing}
+     *
+     * Description:
+     *   Whether operations are being recorded into a [[graph]].
+     *
+     * @endDoc
+     */
+    bool isCapturing() const;
+    //  |===============================
+
     //  |---[ Kernel ]------------------
     void setupKernelInfo(const occa::json &props,
                          const hash_t &sourceHash,
                          occa::json &kernelProps,
                          hash_t &kernelHash) const;
 
+    hash_t baseKernelHash(const occa::json &kernelProps,
+                          const hash_t &sourceHash) const;
+
     hash_t applyDependencyHash(const hash_t &kernelHash) const;
 
     /**
@@ -573,6 +747,13 @@ namespace occa {
                              const std::string &kernelName,
                              const occa::json &props = occa::json()) const;
 
+    /**
+     * @doc{buildKernel}
+     */
+    occa::kernel buildKernel(const std::string &filename,
+                             const std::string &kernelName,
+                             const resolvedProperties &props) const;
+
     /**
      * @startDoc{buildKernelFromString}
      *
@@ -597,6 +778,41 @@ namespace occa {
                                        const std::string &kernelName,
                                        const occa::json &props = occa::json()) const;
 
+    /**
+     * @doc{buildKernelFromString}
+     */
+    occa::kernel buildKernelFromString(const std::string &content,
+                                       const std::string &kernelName,
+                                       const resolvedProperties &props) const;
+
+    /**
+     * @startDoc{buildKernels}
+     *
+     * Description:
+     *   Same as calling [[device.buildKernel]] on each entry but kernels are parsed and compiled concurrently.
+     *
+     *   Entries sharing the same source and properties are compiled only once.
+     *   Compiled binaries are written to the cache directory atomically so
+     *   multiple processes can share it.
+     *
+     *   The number of worker threads can be set through the `threads` property,
+     *   defaulting to the number of hardware threads.
+     *   Backends that can't build kernels concurrently fall back to building them one at a time.
+     *
+     * Arguments:
+     *   builds:
+     *     The `{filename, kernelName, props}` of each kernel
+     *   props:
+     *     Batch [[properties|json]], such as `threads`
+     *
+     * Returns:
+     *   The compiled [[kernel]] objects, in the same order as `builds`.
+     *
+     * @endDoc
+     */
+    kernelVector buildKernels(const kernelBuildInfoVector &builds,
+                              const occa::json &props = occa::json()) const;
+
     occa::kernel buildKernelFromBinary(const std::string &filename,
                                        const std::string &kernelName,
                                        const occa::json &props = occa::json()) const;
@@ -653,6 +869,27 @@ namespace occa {
     occa::memory malloc(const dim_t entries,
                         const occa::json &props);
 
+    /**
+     * @startDoc{malloc[6]}
+     *
+     * Overloaded Description:
+     *   Same but with properties from [[device.resolveMemoryProperties]],
+     *   skipping the property merge on each allocation.
+     *
+     * @endDoc
+     */
+    template <class T = void>
+    occa::memory malloc(const dim_t entries,
+                        const void *src,
+                        const resolvedProperties &props);
+
+    /**
+     * @doc{malloc[7]}
+     */
+    template <class T = void>
+    occa::memory malloc(const dim_t entries,
+                        const resolvedProperties &props);
+
     /**
      * @startDoc{malloc[3]}
      *
@@ -694,6 +931,21 @@ namespace occa {
                         const dtype_t &dtype,
                         const occa::json &props);
 
+    /**
+     * @doc{malloc[8]}
+     */
+    occa::memory malloc(const dim_t entries,
+                        const dtype_t &dtype,
+                        const void *src,
+                        const resolvedProperties &props);
+
+    /**
+     * @doc{malloc[9]}
+     */
+    occa::memory malloc(const dim_t entries,
+                        const dtype_t &dtype,
+                        const resolvedProperties &props);
+
     /**
      * @startDoc{wrapMemory}
      *
@@ -737,6 +989,33 @@ namespace occa {
      * Description:
      *   Creates and returns a new [[memoryPool]] to reserve [[memory]].
      *
+     *   # Allocators
+     *
+     *   The `allocator` property picks how free space is found
+     *
+     *   - `"scan"` (default): Scans all reservations, O(n) per reserve and free
+     *   - `"best_fit"`: Keeps a best-fit free list, O(log n) per reserve and free
+     *
+     *   # Growth
+     *
+     *   The `growth` property picks what happens when a reservation doesn't fit
+     *
+     *   - `"reallocate"` (default): Allocates a larger buffer and moves all reservations into it
+     *   - `"slabs"`: Allocates a new slab and never moves reservations, see [[memoryPool.compact]].
+     *     New slabs are `slab_size` bytes if set, otherwise they match the current pool size.
+     *
+     *   # Threads
+     *
+     *   Pools are not thread-safe unless created with `thread_cache: true`.
+     *   Each thread then reserves from its own slabs without taking a pool-wide lock,
+     *   and only goes to the shared pool for a new or empty slab (1 MB unless `slab_size` is set).
+     *   Memory can be freed from any thread, and a thread's slabs go back to the shared pool when it exits.
+     *   See [[memoryPool.threadCacheStats]].
+     *
+     * Arguments:
+     *   props:
+     *     Memory properties used by the pool and its reservations
+     *
      * Returns:
      *   Newly created [[memoryPool]]
      *
@@ -783,6 +1062,15 @@ namespace occa {
   template <>
   occa::memory device::malloc<void>(const dim_t entries,
                                     const occa::json &props);
+
+  template <>
+  occa::memory device::malloc<void>(const dim_t entries,
+                                    const void *src,
+                                    const resolvedProperties &props);
+
+  template <>
+  occa::memory device::malloc<void>(const dim_t entries,
+                                    const resolvedProperties &props);
 }
 
 #include "device.tpp"
@@ -19,6 +19,19 @@ namespace occa {
     return malloc(entries, occa::dtype::get<T>(), props);
   }
 
+  template <class T>
+  occa::memory device::malloc(const dim_t entries,
+                              const void *src,
+                              const resolvedProperties &props) {
+    return malloc(entries, occa::dtype::get<T>(), src, props);
+  }
+
+  template <class T>
+  occa::memory device::malloc(const dim_t entries,
+                              const resolvedProperties &props) {
+    return malloc(entries, occa::dtype::get<T>(), NULL, props);
+  }
+
   template <>
   occa::memory device::wrapMemory<void>(const void *ptr,
                                         const dim_t entries,
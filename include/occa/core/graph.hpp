@@ -0,0 +1,141 @@
+#ifndef OCCA_CORE_GRAPH_HEADER
+#define OCCA_CORE_GRAPH_HEADER
+
+#include <memory>
+#include <vector>
+
+#include <occa/core/device.hpp>
+#include <occa/core/streamTag.hpp>
+
+namespace occa {
+  class modeGraph_t;
+
+  /**
+   * @startDoc{graph}
+   *
+   * Description:
+   *   A sequence of kernel launches, memory copies and stream tags recorded
+   *   between [[device.beginCapture]] and [[device.endCapture]].
+   *
+   *   Arguments are validated and dependencies between the recorded operations
+   *   are found once, when the graph is created, so [[graph.replay]] only
+   *   launches the recorded work.
+   *
+   *   ```cpp
+   *   device.beginCapture();
+   *   for (int i = 0; i < 40; ++i) {
+   *     kernels[i](entries, o_a, o_b);
+   *   }
+   *   o_a.copyTo(o_c);
+   *   occa::graph step = device.endCapture();
+   *
+   *   for (int i = 0; i < steps; ++i) {
+   *     step.replay();
+   *   }
+   *   ```
+   *
+   * @endDoc
+   */
+  class graph {
+  private:
+    std::shared_ptr<modeGraph_t> modeGraph;
+
+  public:
+    graph();
+    graph(modeGraph_t *modeGraph_);
+
+  private:
+    void assertInitialized() const;
+
+  public:
+    /**
+     * @startDoc{isInitialized}
+     *
+     * Description:
+     *   Check whether the [[graph]] has been captured.
+     *
+     * @endDoc
+     */
+    bool isInitialized() const;
+
+    modeGraph_t* getModeGraph() const;
+
+    /**
+     * @startDoc{getDevice}
+     *
+     * Description:
+     *   Returns the [[device]] the [[graph]] was captured on.
+     *
+     * @endDoc
+     */
+    occa::device getDevice() const;
+
+    /**
+     * @startDoc{size}
+     *
+     * Description:
+     *   Returns the number of recorded operations.
+     *
+     * @endDoc
+     */
+    int size() const;
+
+    /**
+     * @startDoc{depth}
+     *
+     * Description:
+     *   Returns the length of the longest chain of dependent operations.
+     *   A graph where every operation depends on the previous one has a
+     *   depth equal to its [[graph.size]].
+     *
+     * @endDoc
+     */
+    int depth() const;
+
+    /**
+     * @startDoc{isConcurrent}
+     *
+     * Description:
+     *   Whether independent operations are run concurrently on replay.
+     *   Graphs are only concurrent when captured with `concurrent: true`,
+     *   see [[device.beginCapture]] for how dependencies are found.
+     *
+     * @endDoc
+     */
+    bool isConcurrent() const;
+
+    /**
+     * @startDoc{replay}
+     *
+     * Description:
+     *   Runs the recorded operations, each one on the [[stream]] it was
+     *   recorded on.
+     *
+     * @endDoc
+     */
+    void replay();
+
+    /**
+     * @startDoc{tags}
+     *
+     * Description:
+     *   Returns the [[streamTags|streamTag]] created by the last
+     *   [[graph.replay]], in the order they were recorded.
+     *
+     * @endDoc
+     */
+    const std::vector<streamTag>& tags() const;
+
+    /**
+     * @startDoc{free}
+     *
+     * Description:
+     *   Releases the recorded operations.
+     *
+     * @endDoc
+     */
+    void free();
+  };
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef OCCA_CORE_KERNELARG_HEADER
 #define OCCA_CORE_KERNELARG_HEADER
 
+#include <algorithm>
+#include <cstddef>
 #include <vector>
 
 #include <occa/defines.hpp>
@@ -39,6 +41,112 @@ namespace occa {
   };
   //====================================
 
+  //---[ inlineKernelArgDataVector ]----
+  // Storage for kernelArg::args
+  //   Most kernelArgs hold a single value, which is stored inline so
+  //   building the arguments of a kernel launch doesn't allocate.
+  //   Converts to kernelArgDataVector for code expecting a std::vector.
+  class inlineKernelArgDataVector {
+   public:
+    typedef kernelArgData value_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef kernelArgData& reference;
+    typedef const kernelArgData& const_reference;
+    typedef kernelArgData* pointer;
+    typedef const kernelArgData* const_pointer;
+    // Like std::vector, iterators are invalidated when the storage grows
+    typedef kernelArgData* iterator;
+    typedef const kernelArgData* const_iterator;
+
+   private:
+    size_type count;
+    kernelArgData inlineData;
+    std::vector<kernelArgData> heapData;
+
+   public:
+    inlineKernelArgDataVector();
+
+    inline size_type size() const {
+      return count;
+    }
+
+    inline bool empty() const {
+      return !count;
+    }
+
+    inline size_type capacity() const {
+      return std::max<size_type>(1, heapData.capacity());
+    }
+
+    inline kernelArgData* data() {
+      return (count > 1) ? heapData.data() : &inlineData;
+    }
+
+    inline const kernelArgData* data() const {
+      return (count > 1) ? heapData.data() : &inlineData;
+    }
+
+    inline iterator begin() {
+      return data();
+    }
+
+    inline iterator end() {
+      return data() + count;
+    }
+
+    inline const_iterator begin() const {
+      return data();
+    }
+
+    inline const_iterator end() const {
+      return data() + count;
+    }
+
+    inline const_iterator cbegin() const {
+      return begin();
+    }
+
+    inline const_iterator cend() const {
+      return end();
+    }
+
+    inline reference operator [] (const size_type index) {
+      return data()[index];
+    }
+
+    inline const_reference operator [] (const size_type index) const {
+      return data()[index];
+    }
+
+    inline reference front() {
+      return data()[0];
+    }
+
+    inline const_reference front() const {
+      return data()[0];
+    }
+
+    inline reference back() {
+      return data()[count - 1];
+    }
+
+    inline const_reference back() const {
+      return data()[count - 1];
+    }
+
+    // Only allocates when reserving space for more than one argument
+    void reserve(const size_type capacity_);
+    void push_back(const kernelArgData &arg);
+    void pop_back();
+    void clear();
+
+    inline operator kernelArgDataVector () const {
+      return kernelArgDataVector(begin(), end());
+    }
+  };
+  //====================================
+
   //---[ kernelArg ]--------------------
   /**
    * @startDoc{kernelArg}
@@ -55,7 +163,7 @@ namespace occa {
    */
   class kernelArg : public generic {
    public:
-    kernelArgDataVector args;
+    inlineKernelArgDataVector args;
 
     kernelArg();
     kernelArg(const kernelArgData &arg);
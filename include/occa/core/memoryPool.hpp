@@ -180,6 +180,38 @@ namespace occa {
      */
     void shrinkToFit();
 
+    /**
+     * @startDoc{compact}
+     *
+     * Description:
+     *   Pack the active reservations to release unused space back to the device.
+     *   Reservations are moved so only call this when they are not in use.
+     *
+     *   Pools created with `growth: "slabs"` never move reservations on their own,
+     *   this is the only call that does.
+     *   Each slab is packed separately and empty slabs are freed.
+     *
+     * @endDoc
+     */
+    void compact();
+
+    /**
+     * @startDoc{threadCacheStats}
+     *
+     * Description:
+     *   Per-thread statistics for pools created with `thread_cache: true`.
+     *
+     * Returns:
+     *   An array with an entry per live thread that reserved from the pool with:
+     *   - `hits`: Reservations served from the thread's own slabs
+     *   - `misses`: Reservations that needed a slab from the shared pool
+     *   - `slabs`: Number of slabs held by the thread
+     *   - `bytes`: Bytes held by the thread's slabs
+     *
+     * @endDoc
+     */
+    occa::json threadCacheStats() const;
+
     /**
      * @startDoc{free}
      *
@@ -0,0 +1,113 @@
+#ifndef OCCA_CORE_RESOLVEDPROPERTIES_HEADER
+#define OCCA_CORE_RESOLVEDPROPERTIES_HEADER
+
+#include <memory>
+
+#include <occa/defines.hpp>
+#include <occa/types/json.hpp>
+
+namespace occa {
+  class modeDevice_t; class device;
+
+  /**
+   * @startDoc{resolvedProperties}
+   *
+   * Description:
+   *   Properties merged and hashed once against a [[device]], returned by
+   *   [[device.resolveMemoryProperties]], [[device.resolveKernelProperties]] and
+   *   [[device.resolveStreamProperties]].
+   *
+   *   Passing them to [[device.malloc]], [[device.buildKernel]] or [[device.createStream]]
+   *   skips merging the device defaults with the given properties on every call.
+   *
+   *   ```cpp
+   *   occa::resolvedProperties memProps = device.resolveMemoryProperties({
+   *     {"use_host_pointer", true}
+   *   });
+   *
+   *   for (int i = 0; i < 1000; ++i) {
+   *     occa::memory mem = device.malloc<float>(entries, src, memProps);
+   *   }
+   *   ```
+   *
+   *   Resolved properties are immutable and cheap to copy.
+   *   They can only be created through a [[device]], passing `{}` as properties
+   *   still calls the [[json]] overloads.
+   *   They can only be used with the [[device]] and call type they were resolved for.
+   *
+   * @endDoc
+   */
+  class resolvedProperties {
+    friend class occa::device;
+
+  public:
+    enum type_t {
+      none_,
+      memory_,
+      kernel_,
+      stream_
+    };
+
+  private:
+    struct data_t {
+      modeDevice_t *modeDevice;
+      type_t type;
+      occa::json props;
+      hash_t hash;
+      // Device, mode and kernel header hash used by device::buildKernel
+      hash_t kernelHash;
+    };
+
+    std::shared_ptr<const data_t> data;
+
+    // Only created by the device
+    //   Having no default constructor keeps `{}` arguments unambiguous
+    resolvedProperties(modeDevice_t *modeDevice_,
+                       const type_t type_,
+                       occa::json &&props_,
+                       const hash_t &kernelHash_ = hash_t());
+
+  public:
+    /**
+     * @startDoc{isInitialized}
+     *
+     * Description:
+     *   Check whether the [[resolvedProperties]] has been resolved against a [[device]],
+     *   which is only false after being moved from.
+     *
+     * @endDoc
+     */
+    bool isInitialized() const;
+
+    type_t type() const;
+
+    /**
+     * @startDoc{properties}
+     *
+     * Description:
+     *   Returns the merged [[properties|json]].
+     *
+     * @endDoc
+     */
+    const occa::json& properties() const;
+
+    /**
+     * @startDoc{hash}
+     *
+     * Description:
+     *   Returns the [[hash|hash_t]] of the merged properties, computed once when resolved.
+     *
+     * @endDoc
+     */
+    const hash_t& hash() const;
+
+    bool operator == (const resolvedProperties &other) const;
+    bool operator != (const resolvedProperties &other) const;
+
+  private:
+    void assertResolvedFor(modeDevice_t *modeDevice_,
+                           const type_t type_) const;
+  };
+}
+
+#endif
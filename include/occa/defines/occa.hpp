@@ -15,6 +15,9 @@
 #define OKL_VERSION       20000
 #define OKL_VERSION_STR   "2.0.0"
 
+// Bump when cached files are no longer compatible, such as changes in hashing
+#define OCCA_CACHE_VERSION 3
+
 #define OCCA_DEFAULT_MEM_BYTE_ALIGN 32
 
 #endif
@@ -2,6 +2,7 @@
 #define OCCA_FUNCTIONAL_HEADER
 
 #include <occa/functional/array.hpp>
+#include <occa/functional/arrayExpression.hpp>
 #include <occa/functional/function.hpp>
 #include <occa/functional/range.hpp>
 #include <occa/functional/scope.hpp>
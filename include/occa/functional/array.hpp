@@ -6,6 +6,9 @@
 namespace occa {
   class kernelArg;
 
+  template <class T>
+  class arrayExpression;
+
   template <class T>
   class array : public typelessArray {
     template <class T2>
@@ -68,6 +71,110 @@ namespace occa {
       return "occa_array_ptr[0]";
     }
 
+  private:
+    // Primitives can return empty memory, which doesn't keep the device
+    template <class T2>
+    array<T2> primitiveResult(occa::memory mem) const {
+      if (mem.isInitialized()) {
+        return array<T2>(mem);
+      }
+      array<T2> emptyArray;
+      emptyArray.setupTypelessArray(device_, dtype::get<T2>());
+      return emptyArray;
+    }
+
+    array filterWith(const baseFunction &fn) const {
+      if (!length()) {
+        return primitiveResult<T>(occa::memory());
+      }
+
+      occa::memory flags = device_.template malloc<int>(length());
+      typelessMapTo(flags, fn);
+
+      return primitiveResult<T>(
+        typelessCompact(memory_, flags)
+      );
+    }
+
+    array scanWith(reductionType type,
+                   const bool inclusive) const {
+      if (!length()) {
+        return primitiveResult<T>(occa::memory());
+      }
+
+      const std::string identity = functional::reductionIdentity<T>(type);
+      OCCA_ERROR("Scans are only supported on arithmetic types",
+                 identity.size());
+
+      occa::memory output = device_.template malloc<T>(length());
+      typelessScan(memory_, output, type, inclusive, identity);
+
+      return array(output);
+    }
+
+    static occa::function<bool(const T&, const int, const T*)> isSegmentStart() {
+      return OCCA_FUNCTION([=](const T &value, const int index, const T *values) -> bool {
+        return (index == 0) || (values[index - 1] != value);
+      });
+    }
+
+    //---[ Radix sort keys ]------------
+    // Keys are sorted through the unsigned integers with the same bits
+    static dtype_t radixKeyDtype() {
+      switch (sizeof(T)) {
+        case 1: return dtype::char_;
+        case 2: return dtype::short_;
+        case 4: return dtype::int_;
+        default: return dtype::int64;
+      }
+    }
+
+    static std::string radixKeyType() {
+      switch (sizeof(T)) {
+        case 1: return "unsigned char";
+        case 2: return "unsigned short";
+        case 4: return "unsigned int";
+        default:
+          // OKL doesn't parse uint64_t, so use the 64-bit type on LP64 and LLP64 hosts
+          return (
+            sizeof(unsigned long) == sizeof(uint64_t)
+            ? "unsigned long"
+            : "unsigned long long"
+          );
+      }
+    }
+
+    static std::string radixKeyValue() {
+      if (std::is_unsigned<T>::value) {
+        return "(KEY)";
+      }
+
+      const std::string signBit = (
+        "(((OCCA_ARRAY_RADIX_KEY) 1) << " + std::to_string(8 * sizeof(T) - 1) + ")"
+      );
+      if (std::is_integral<T>::value) {
+        return "((KEY) ^ " + signBit + ")";
+      }
+      // Negative floats sort in reverse order of their bits
+      return "(((KEY) & " + signBit + ") ? ~(KEY) : ((KEY) ^ " + signBit + "))";
+    }
+
+    void radixSort(occa::memory values,
+                   occa::memory &sortedKeys,
+                   occa::memory &sortedValues) const {
+      static_assert(std::is_arithmetic<T>::value,
+                    "Only arrays of arithmetic types can be sorted");
+
+      typelessRadixSort(memory_.cast(radixKeyDtype()),
+                        values,
+                        (int) sizeof(T),
+                        radixKeyType(),
+                        radixKeyValue(),
+                        sortedKeys,
+                        sortedValues);
+    }
+    //==================================
+
   public:
     //---[ Memory methods ]-------------
     bool isInitialized() const {
@@ -168,6 +275,9 @@ namespace occa {
 
     //---[ Lambda methods ]-------------
   public:
+    // Maps, filters and reductions on the returned expression run as one kernel
+    arrayExpression<T> lazy() const;
+
     bool every(const occa::function<bool(const T&)> &fn) const {
       return typelessEvery(fn);
     }
@@ -254,6 +364,18 @@ namespace occa {
       return output;
     }
 
+    array filter(const occa::function<bool(const T&)> &fn) const {
+      return filterWith(fn);
+    }
+
+    array filter(const occa::function<bool(const T&, const int)> &fn) const {
+      return filterWith(fn);
+    }
+
+    array filter(const occa::function<bool(const T&, const int, const T*)> &fn) const {
+      return filterWith(fn);
+    }
+
     template <class T2>
     T2 reduce(reductionType type,
                const occa::function<T2(const T2&, const T&)> &fn) const {
@@ -535,7 +657,111 @@ namespace occa {
       );
     }
     //==================================
+
+    //---[ Parallel primitives ]--------
+    array inclusiveScan(reductionType type = reductionType::sum) const {
+      return scanWith(type, true);
+    }
+
+    array exclusiveScan(reductionType type = reductionType::sum) const {
+      return scanWith(type, false);
+    }
+
+    // Removes consecutive duplicates
+    array unique() const {
+      return filter(isSegmentStart());
+    }
+
+    // sort(), sortByKey() and histogram() count and scatter each block on a
+    //   single thread. They aren't performance-tuned for GPU modes yet.
+    array sort() const {
+      if (!length()) {
+        return primitiveResult<T>(occa::memory());
+      }
+
+      occa::memory sortedKeys, sortedValues;
+      radixSort(occa::memory(), sortedKeys, sortedValues);
+
+      return array(sortedKeys);
+    }
+
+    // Returns the sorted keys and moves [values] along with them
+    template <class V>
+    array sortByKey(array<V> &values) const {
+      OCCA_ERROR("Keys and values must have the same length",
+                 values.length() == length());
+
+      if (!length()) {
+        return primitiveResult<T>(occa::memory());
+      }
+
+      occa::memory sortedKeys, sortedValues;
+      radixSort(values.memory_, sortedKeys, sortedValues);
+
+      values = array<V>(sortedValues);
+      return array(sortedKeys);
+    }
+
+    // Counts the values in [minValue, maxValue] into [bins] equal bins
+    array<int> histogram(const int bins,
+                         const T minValue,
+                         const T maxValue) const {
+      OCCA_ERROR("Histograms need at least one bin",
+                 bins > 0);
+      OCCA_ERROR("Histogram minimum [" << minValue << "] is larger than its maximum [" << maxValue << "]",
+                 minValue <= maxValue);
+
+      if (!length()) {
+        return array<int>(device_, bins).fill(0);
+      }
+
+      return array<int>(
+        typelessHistogram(memory_, bins, (double) minValue, (double) maxValue)
+      );
+    }
+
+    // Reduces the [values] of each run of equal keys into [reducedValues]
+    //   and returns the key of each run
+    template <class V>
+    array reduceByKey(const array<V> &values,
+                      array<V> &reducedValues,
+                      reductionType type = reductionType::sum) const {
+      OCCA_ERROR("Keys and values must have the same length",
+                 values.length() == length());
+
+      const int arrayLength = (int) length();
+      if (!arrayLength) {
+        reducedValues = primitiveResult<V>(occa::memory());
+        return primitiveResult<T>(occa::memory());
+      }
+
+      occa::memory segmentFlags = device_.template malloc<int>(arrayLength);
+      typelessMapTo(segmentFlags, isSegmentStart());
+      const int segmentCount = typelessScanFlags(segmentFlags);
+
+      occa::memory segmentKeys = device_.template malloc<T>(segmentCount);
+      occa::memory segmentStarts = device_.template malloc<int>(segmentCount);
+
+      occa::scope scatterScope({
+        {"occa_array_input", memory_},
+        {"occa_array_output", segmentKeys},
+        {"occa_array_starts", segmentStarts}
+      }, {
+        {"defines/OCCA_ARRAY_SCATTER(POSITION, INDEX)",
+         "occa_array_output[POSITION] = occa_array_input[INDEX];"
+         " occa_array_starts[POSITION] = INDEX"}
+      });
+      typelessScatterFlagged(segmentFlags, scatterScope);
+
+      reducedValues = array<V>(
+        typelessSegmentedReduce(values.memory_, segmentStarts, type)
+      );
+      return array(segmentKeys);
+    }
+    //==================================
   };
 }
 
+#include <occa/functional/arrayExpression.hpp>
+
 #endif
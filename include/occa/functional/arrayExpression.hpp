@@ -0,0 +1,350 @@
+#ifndef OCCA_FUNCTIONAL_ARRAYEXPRESSION_HEADER
+#define OCCA_FUNCTIONAL_ARRAYEXPRESSION_HEADER
+
+#include <memory>
+#include <vector>
+
+#include <occa/functional/array.hpp>
+
+namespace occa {
+  // A map or filter recorded in an array expression
+  struct arrayExpressionStage {
+    std::shared_ptr<baseFunction> fn;
+    bool isFilter;
+  };
+
+  // Records maps and filters on an array without running them
+  //   The chain is fused into the kernel of the operation that ends it,
+  //   so the array is read once and no temporaries are allocated
+  template <class T>
+  class arrayExpression : public typelessArray {
+    template <class T2>
+    friend class arrayExpression;
+
+    template <class T2>
+    friend class array;
+
+  private:
+    occa::memory memory_;
+    std::vector<arrayExpressionStage> stages;
+
+    // Stages inlined into OCCA_ARRAY_FUNCTION_CALL, the rest are passed
+    //   as the kernel's function
+    int fusedStageCount;
+    // Initial value of the reduction being launched
+    std::string reductionIdentity;
+
+    arrayExpression(const typelessArray &source,
+                    occa::memory mem) :
+      typelessArray(source),
+      memory_(mem),
+      fusedStageCount(0) {
+      // T is the type of the values after the stages, not the source's type
+      setupTypelessArray(memory_.getDevice(), dtype::get<T>());
+    }
+
+    template <class T2>
+    arrayExpression(const arrayExpression<T2> &other,
+                    const std::shared_ptr<baseFunction> &fn,
+                    const bool isFilter) :
+      typelessArray(other),
+      memory_(other.memory_),
+      stages(other.stages),
+      fusedStageCount(0) {
+      stages.push_back({fn, isFilter});
+      setupTypelessArray(memory_.getDevice(), dtype::get<T>());
+    }
+
+    bool hasFilters(const int stageCount) const {
+      for (int i = 0; i < stageCount; ++i) {
+        if (stages[i].isFilter) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    static std::string stageFunctionName(const int stageIndex) {
+      return "occa_array_stage" + std::to_string(stageIndex);
+    }
+
+    static std::string stageArgName(const int stageIndex,
+                                    const std::string &name) {
+      return stageFunctionName(stageIndex) + "_" + name;
+    }
+
+    std::string buildStageCall(const int stageIndex,
+                               const std::string &value) const {
+      const baseFunction &fn = *(stages[stageIndex].fn);
+
+      strVector argumentValues = {value, "INDEX"};
+      argumentValues.resize(fn.argumentCount());
+
+      // Captured variables are renamed since stages can capture the same names
+      for (const scopeKernelArg &arg : fn.scope.args) {
+        argumentValues.push_back(stageArgName(stageIndex, arg.name));
+      }
+
+      std::string call = stageFunctionName(stageIndex);
+      call += '(';
+      for (size_t i = 0; i < argumentValues.size(); ++i) {
+        if (i) {
+          call += ", ";
+        }
+        call += argumentValues[i];
+      }
+      call += ')';
+
+      return call;
+    }
+
+    // Sets [value] to the fused stages applied to occa_array_ptr[INDEX]
+    //   and returns whether it passes the filters
+    std::string buildFusedStages(std::string &value) const {
+      std::string condition;
+
+      value = "occa_array_ptr[INDEX]";
+      for (int i = 0; i < fusedStageCount; ++i) {
+        const std::string call = buildStageCall(i, value);
+        if (!stages[i].isFilter) {
+          value = call;
+          continue;
+        }
+        if (condition.size()) {
+          condition += " && ";
+        }
+        condition += call;
+      }
+
+      return condition;
+    }
+
+    void addStageScopes(occa::scope &scope) const {
+      for (int i = 0; i < fusedStageCount; ++i) {
+        const baseFunction &fn = *(stages[i].fn);
+
+        for (const scopeKernelArg &arg : fn.scope.args) {
+          scopeKernelArg stageArg = arg;
+          stageArg.name = stageArgName(i, arg.name);
+          scope.add(stageArg);
+        }
+
+        scope.props += fn.scope.props;
+        scope.props["functions/" + stageFunctionName(i)] = fn.hash();
+      }
+    }
+
+    occa::scope getMapArrayScopeOverrides() const {
+      std::string value;
+      const std::string condition = buildFusedStages(value);
+
+      std::string call = "OCCA_ARRAY_FUNCTION(" + value + ", INDEX, occa_array_ptr)";
+      if (condition.size()) {
+        // Only used as a statement, filtered expressions can't be mapped to arrays
+        call = "if (" + condition + ") " + call;
+      }
+
+      occa::scope scope({
+        {"occa_array_ptr", memory_}
+      }, {
+        {"defines/OCCA_ARRAY_FUNCTION_CALL(INDEX)", call}
+      });
+      addStageScopes(scope);
+
+      return scope;
+    }
+
+    occa::scope getReduceArrayScopeOverrides() const {
+      std::string value;
+      const std::string condition = buildFusedStages(value);
+
+      std::string call = "OCCA_ARRAY_FUNCTION(ACC, " + value + ", INDEX, occa_array_ptr)";
+      if (condition.size()) {
+        call = "((" + condition + ") ? " + call + " : (ACC))";
+      }
+
+      occa::scope scope({
+        {"occa_array_ptr", memory_}
+      }, {
+        {"defines/OCCA_ARRAY_FUNCTION_CALL(ACC, INDEX)", call}
+      });
+      addStageScopes(scope);
+
+      return scope;
+    }
+
+    // The first value can be filtered out or have a different type,
+    //   so reductions start from the operation's identity
+    std::string reductionInitialValue() const {
+      OCCA_ERROR("Reductions on array expressions of this type need an initial value",
+                 reductionIdentity.size());
+      return reductionIdentity;
+    }
+
+    // Evaluators launch from a copy holding the code generation state,
+    //   so const evaluations on the same expression can run concurrently
+    arrayExpression fusedExpression(const int fusedStageCount_,
+                                    const std::string &reductionIdentity_ = "") const {
+      arrayExpression expression(*this);
+      expression.fusedStageCount = fusedStageCount_;
+      expression.reductionIdentity = reductionIdentity_;
+      return expression;
+    }
+
+    template <class T2>
+    T2 fusedReduce(reductionType type,
+                   const T2 &localInit,
+                   const bool useLocalInit,
+                   const baseFunction &fn) const {
+      return fusedExpression(
+        (int) stages.size(),
+        functional::reductionIdentity<T2>(type)
+      ).template typelessReduce<T2>(type, localInit, useLocalInit, fn);
+    }
+
+    void fusedForEach(const baseFunction &fn) const {
+      fusedExpression((int) stages.size()).typelessForEach(fn);
+    }
+
+  public:
+    arrayExpression(const arrayExpression &other) :
+      typelessArray(other),
+      memory_(other.memory_),
+      stages(other.stages),
+      fusedStageCount(0) {}
+
+    arrayExpression& operator = (const arrayExpression &other) {
+      typelessArray::operator = (other);
+      memory_ = other.memory_;
+      stages = other.stages;
+
+      return *this;
+    }
+
+    udim_t length() const {
+      return memory_.length();
+    }
+
+    int stageCount() const {
+      return (int) stages.size();
+    }
+
+    //---[ Lazy methods ]---------------
+    template <class T2>
+    arrayExpression<T2> map(const occa::function<T2(const T&)> &fn) const {
+      return arrayExpression<T2>(*this, std::make_shared<occa::function<T2(const T&)>>(fn), false);
+    }
+
+    template <class T2>
+    arrayExpression<T2> map(const occa::function<T2(const T&, const int)> &fn) const {
+      return arrayExpression<T2>(*this, std::make_shared<occa::function<T2(const T&, const int)>>(fn), false);
+    }
+
+    arrayExpression filter(const occa::function<bool(const T&)> &fn) const {
+      return arrayExpression(*this, std::make_shared<occa::function<bool(const T&)>>(fn), true);
+    }
+
+    arrayExpression filter(const occa::function<bool(const T&, const int)> &fn) const {
+      return arrayExpression(*this, std::make_shared<occa::function<bool(const T&, const int)>>(fn), true);
+    }
+    //==================================
+
+    //---[ Evaluating methods ]---------
+    void forEach(const occa::function<void(const T&)> &fn) const {
+      fusedForEach(fn);
+    }
+
+    void forEach(const occa::function<void(const T&, const int)> &fn) const {
+      fusedForEach(fn);
+    }
+
+    template <class T2>
+    T2 reduce(reductionType type,
+              const occa::function<T2(const T2&, const T&)> &fn) const {
+      return fusedReduce<T2>(type, T2(), false, fn);
+    }
+
+    template <class T2>
+    T2 reduce(reductionType type,
+              const occa::function<T2(const T2&, const T&, const int)> &fn) const {
+      return fusedReduce<T2>(type, T2(), false, fn);
+    }
+
+    template <class T2>
+    T2 reduce(reductionType type,
+              const T2 &localInit,
+              const occa::function<T2(const T2&, const T&)> &fn) const {
+      return fusedReduce<T2>(type, localInit, true, fn);
+    }
+
+    template <class T2>
+    T2 reduce(reductionType type,
+              const T2 &localInit,
+              const occa::function<T2(const T2&, const T&, const int)> &fn) const {
+      return fusedReduce<T2>(type, localInit, true, fn);
+    }
+
+    T sum() const {
+      return reduce<T>(
+        reductionType::sum,
+        OCCA_FUNCTION([=](const T &acc, const T &value) -> T {
+          return acc + value;
+        })
+      );
+    }
+
+    T max() const {
+      return reduce<T>(
+        reductionType::max,
+        OCCA_FUNCTION([=](const T &currentMax, const T &value) -> T {
+          return currentMax > value ? currentMax : value;
+        })
+      );
+    }
+
+    T min() const {
+      return reduce<T>(
+        reductionType::min,
+        OCCA_FUNCTION([=](const T &currentMin, const T &value) -> T {
+          return currentMin < value ? currentMin : value;
+        })
+      );
+    }
+
+    T dotProduct(const array<T> &other) const {
+      occa::scope fnScope({
+        {"other", other}
+      });
+
+      return reduce<T>(
+        reductionType::sum,
+        OCCA_FUNCTION(fnScope, [=](const T &acc, const T &value, const int index) -> T {
+          return acc + (value * other[index]);
+        })
+      );
+    }
+
+    array<T> toArray() const {
+      const int stageCount_ = (int) stages.size();
+      if (!stageCount_) {
+        return array<T>(memory_.clone());
+      }
+
+      OCCA_ERROR("Filtered array expressions can only be reduced or iterated over",
+                 !hasFilters(stageCount_));
+
+      // The last map writes the output
+      return array<T>(
+        fusedExpression(stageCount_ - 1).template typelessMap<T>(*(stages.back().fn))
+      );
+    }
+    //==================================
+  };
+
+  template <class T>
+  arrayExpression<T> array<T>::lazy() const {
+    return arrayExpression<T>(*this, memory_);
+  }
+}
+
+#endif
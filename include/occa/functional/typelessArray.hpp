@@ -50,36 +50,43 @@ namespace occa {
       return occa::scope();
     }
 
-    occa::scope getMapArrayScope(const baseFunction &fn) const {
-      const int arrayLength = (int) length();
-
+    // Scope for OCCA_ARRAY_TILE_FOR_LOOP and OCCA_ARRAY_TILE_PARALLEL_FOR_LOOP,
+    //   which loop over [i] from 0 to occa_array_length
+    occa::scope getTiledLoopScope(const int arrayLength) const {
       const int safeTileSize = std::min(
         std::max(1, tileSize),
-        arrayLength
+        std::max(1, arrayLength)
       );
       const int safeTileIterations = std::min(
         std::max(1, tileIterations),
-        (arrayLength + safeTileSize - 1) / safeTileSize
+        std::max(1, (arrayLength + safeTileSize - 1) / safeTileSize)
       );
 
       std::string tileForLoop;
       std::string parallelForLoop;
       buildMapTiledForLoops(tileForLoop, parallelForLoop);
 
-      occa::scope baseScope({
-        {"occa_array_length", arrayLength},
-        {"occa_array_return", returnMemory}
+      occa::scope loopScope({
+        {"occa_array_length", arrayLength}
       }, {
-        {"defines/T", dtype_.name()},
         {"defines/OCCA_ARRAY_TILE_SIZE", safeTileSize},
         {"defines/OCCA_ARRAY_TILE_ITERATIONS", safeTileIterations},
-        {"defines/OCCA_ARRAY_FUNCTION(VALUE, INDEX, VALUES_PTR)", buildMapFunctionCall(fn)},
         {"defines/OCCA_ARRAY_TILE_FOR_LOOP", tileForLoop},
-        {"defines/OCCA_ARRAY_TILE_PARALLEL_FOR_LOOP", parallelForLoop},
-        {"functions/occa_array_function", fn}
+        {"defines/OCCA_ARRAY_TILE_PARALLEL_FOR_LOOP", parallelForLoop}
       });
 
-      baseScope.device = device_;
+      loopScope.device = device_;
+
+      return loopScope;
+    }
+
+    occa::scope getMapArrayScope(const baseFunction &fn) const {
+      occa::scope baseScope = getTiledLoopScope((int) length());
+      baseScope.add("occa_array_return", returnMemory);
+
+      baseScope.props["defines/T"] = dtype_.name();
+      baseScope.props["defines/OCCA_ARRAY_FUNCTION(VALUE, INDEX, VALUES_PTR)"] = buildMapFunctionCall(fn);
+      baseScope.props["functions/occa_array_function"] = fn;
 
       return (
         baseScope
@@ -325,7 +332,7 @@ namespace occa {
 
     bool usingNativeCpuMode() const {
       const std::string &mode = device_.mode();
-      return (mode == "Serial" || mode == "OpenMP");
+      return (mode == "Serial" || mode == "OpenMP" || mode == "Threads");
     }
 
   public:
@@ -598,6 +605,580 @@ namespace occa {
       return functional::hostReduction<T2>(type, returnMemory);
     }
     //==================================
+
+    //---[ Primitive methods ]----------
+    // Number of blocks the blocked primitives split [arrayLength] entries into,
+    //   where each block keeps [binCount] counters in global memory
+    int getPrimitiveBlockCount(const int arrayLength,
+                               const int binCount) const {
+      int blockCount;
+      if (usingNativeCpuMode()) {
+        blockCount = 128;
+      } else {
+        // Blocks run on one thread each, so GPUs get more and smaller blocks
+        //   to keep enough of them in flight
+        blockCount = std::min((arrayLength + 255) / 256,
+                              (1 << 22) / std::max(1, binCount));
+      }
+      return std::max(1, std::min(blockCount, arrayLength));
+    }
+
+    occa::scope getBlockedScope(const int arrayLength,
+                                const int blockCount) const {
+      occa::scope blockedScope({
+        {"occa_array_length", arrayLength},
+        {"occa_array_blocks", blockCount}
+      });
+
+      blockedScope.device = device_;
+
+      return blockedScope;
+    }
+
+    // Scans [input] into [output], which can be the same memory
+    void typelessScan(occa::memory input,
+                      occa::memory output,
+                      reductionType type,
+                      const bool inclusive,
+                      const std::string &identity) const {
+      if (!input.length()) {
+        return;
+      }
+      if (usingNativeCpuMode()) {
+        typelessCpuScan(input, output, type, inclusive, identity);
+      } else {
+        typelessGpuScan(input, output, type, inclusive, identity);
+      }
+    }
+
+    void typelessCpuScan(occa::memory input,
+                         occa::memory output,
+                         reductionType type,
+                         const bool inclusive,
+                         const std::string &identity) const {
+      const int arrayLength = (int) input.length();
+      const int blockCount = getPrimitiveBlockCount(arrayLength, 1);
+
+      occa::memory blockTotals = device_.malloc(blockCount, input.dtype());
+
+      occa::scope scope = getBlockedScope(arrayLength, blockCount);
+      scope.add("occa_array_input", input);
+      scope.add("occa_array_output", output);
+      scope.add("occa_array_totals", blockTotals);
+
+      scope.props["defines/T"] = input.dtype().name();
+      scope.props["defines/OCCA_ARRAY_SCAN_IDENTITY"] = identity;
+      scope.props["defines/OCCA_ARRAY_LOCAL_REDUCTION(LEFT_VALUE, RIGHT_VALUE)"] = buildLocalReductionOperation(type);
+
+      // Each block first reduces its values, which the blocks after it start from
+      for (int step = 0; step < 2; ++step) {
+        if (step == 0) {
+          scope.props["defines/OCCA_ARRAY_SCAN_START(ACC, BLOCK)"] = "";
+          scope.props["defines/OCCA_ARRAY_SCAN_STEP(ACC, INDEX)"] = (
+            "ACC = (OCCA_ARRAY_LOCAL_REDUCTION(ACC, occa_array_input[INDEX]))"
+          );
+          scope.props["defines/OCCA_ARRAY_SCAN_END(ACC, BLOCK)"] = "occa_array_totals[BLOCK] = ACC";
+        } else {
+          scope.props["defines/OCCA_ARRAY_SCAN_START(ACC, BLOCK)"] = (
+            "for (int b = 0; b < BLOCK; ++b) {"
+            "  ACC = (OCCA_ARRAY_LOCAL_REDUCTION(ACC, occa_array_totals[b]));"
+            "}"
+          );
+          if (inclusive) {
+            scope.props["defines/OCCA_ARRAY_SCAN_STEP(ACC, INDEX)"] = (
+              "ACC = (OCCA_ARRAY_LOCAL_REDUCTION(ACC, occa_array_input[INDEX]));"
+              " occa_array_output[INDEX] = ACC"
+            );
+          } else {
+            scope.props["defines/OCCA_ARRAY_SCAN_STEP(ACC, INDEX)"] = (
+              "const T value = occa_array_input[INDEX];"
+              " occa_array_output[INDEX] = ACC;"
+              " ACC = (OCCA_ARRAY_LOCAL_REDUCTION(ACC, value))"
+            );
+          }
+          scope.props["defines/OCCA_ARRAY_SCAN_END(ACC, BLOCK)"] = "";
+        }
+
+        OCCA_JIT(scope, (
+          for (int block = 0; block < occa_array_blocks; ++block; @outer) {
+            for (int dummyIndex = 0; dummyIndex < 1; ++dummyIndex; @inner) {
+              const int blockSize = (
+                (occa_array_length + occa_array_blocks - 1) / occa_array_blocks
+              );
+
+              const int startIndex = block * blockSize;
+              const int unsafeEndIndex = startIndex + blockSize;
+              const int endIndex = occa_array_length < unsafeEndIndex ? occa_array_length : unsafeEndIndex;
+
+              T acc = OCCA_ARRAY_SCAN_IDENTITY;
+              OCCA_ARRAY_SCAN_START(acc, block);
+
+              for (int i = startIndex; i < endIndex; ++i) {
+                OCCA_ARRAY_SCAN_STEP(acc, i);
+              }
+
+              OCCA_ARRAY_SCAN_END(acc, block);
+            }
+          }
+        ));
+      }
+    }
+
+    void typelessGpuScan(occa::memory input,
+                         occa::memory output,
+                         reductionType type,
+                         const bool inclusive,
+                         const std::string &identity) const {
+      const int arrayLength = (int) input.length();
+
+      // Scans in shared memory need a power of 2 tile size
+      const int unsafeTileSize = std::min(
+        tileSize <= 0 ? 256 : std::min(1024, tileSize),
+        arrayLength
+      );
+      int safeTileSize = 1024;
+      while ((safeTileSize > 1) && ((safeTileSize >> 1) >= unsafeTileSize)) {
+        safeTileSize >>= 1;
+      }
+      const int tileCount = (arrayLength + safeTileSize - 1) / safeTileSize;
+
+      occa::memory tileOffsets = device_.malloc(tileCount, input.dtype());
+
+      occa::scope scope({
+        {"occa_array_length", arrayLength},
+        {"occa_array_tiles", tileCount},
+        {"occa_array_input", input},
+        {"occa_array_output", output},
+        {"occa_array_offsets", tileOffsets}
+      }, {
+        {"defines/T", input.dtype().name()},
+        {"defines/OCCA_ARRAY_TILE_SIZE", safeTileSize},
+        {"defines/OCCA_ARRAY_SCAN_IDENTITY", identity},
+        {"defines/OCCA_ARRAY_LOCAL_REDUCTION(LEFT_VALUE, RIGHT_VALUE)", buildLocalReductionOperation(type)},
+        // Hillis-Steele step on the tile values
+        {"defines/OCCA_ARRAY_SHARED_SCAN(OFFSET)",
+         "for (int i = 0; i < OCCA_ARRAY_TILE_SIZE; ++i; @inner) {"
+         "  tileScratch[i] = ("
+         "    (i >= OFFSET)"
+         "    ? (OCCA_ARRAY_LOCAL_REDUCTION(tileValues[i - OFFSET], tileValues[i]))"
+         "    : tileValues[i]"
+         "  );"
+         "}"
+         "for (int i = 0; i < OCCA_ARRAY_TILE_SIZE; ++i; @inner) {"
+         "  tileValues[i] = tileScratch[i];"
+         "}"}
+      });
+      scope.device = device_;
+
+      // The first pass writes each tile's total, the second writes
+      //   the scanned tiles starting from the scanned tile totals
+      for (int step = 0; step < 2; ++step) {
+        if (step == 0) {
+          scope.props["defines/OCCA_ARRAY_SCAN_WRITE(TILE, LOCAL, INDEX)"] = (
+            "if (LOCAL == (OCCA_ARRAY_TILE_SIZE - 1)) {"
+            "  occa_array_offsets[TILE] = tileValues[LOCAL];"
+            "}"
+          );
+        } else {
+          const std::string tileValue = (
+            inclusive
+            ? "T tileValue = tileValues[LOCAL];"
+            : "T tileValue = OCCA_ARRAY_SCAN_IDENTITY; if (LOCAL) { tileValue = tileValues[LOCAL - 1]; }"
+          );
+          scope.props["defines/OCCA_ARRAY_SCAN_WRITE(TILE, LOCAL, INDEX)"] = (
+            "if (INDEX < occa_array_length) {"
+            "  " + tileValue +
+            "  occa_array_output[INDEX] = (OCCA_ARRAY_LOCAL_REDUCTION(occa_array_offsets[TILE], tileValue));"
+            "}"
+          );
+        }
+
+        OCCA_JIT(scope, (
+          for (int tile = 0; tile < occa_array_tiles; ++tile; @outer) {
+            @shared T tileValues[OCCA_ARRAY_TILE_SIZE];
+            @shared T tileScratch[OCCA_ARRAY_TILE_SIZE];
+
+            for (int localIndex = 0; localIndex < OCCA_ARRAY_TILE_SIZE; ++localIndex; @inner) {
+              const int index = (tile * OCCA_ARRAY_TILE_SIZE) + localIndex;
+              T value = OCCA_ARRAY_SCAN_IDENTITY;
+              if (index < occa_array_length) {
+                value = occa_array_input[index];
+              }
+              tileValues[localIndex] = value;
+            }
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 1")
+            OCCA_ARRAY_SHARED_SCAN(1)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 2")
+            OCCA_ARRAY_SHARED_SCAN(2)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 4")
+            OCCA_ARRAY_SHARED_SCAN(4)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 8")
+            OCCA_ARRAY_SHARED_SCAN(8)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 16")
+            OCCA_ARRAY_SHARED_SCAN(16)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 32")
+            OCCA_ARRAY_SHARED_SCAN(32)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 64")
+            OCCA_ARRAY_SHARED_SCAN(64)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 128")
+            OCCA_ARRAY_SHARED_SCAN(128)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 256")
+            OCCA_ARRAY_SHARED_SCAN(256)
+          @directive("#endif")
+
+          @directive("#if OCCA_ARRAY_TILE_SIZE > 512")
+            OCCA_ARRAY_SHARED_SCAN(512)
+          @directive("#endif")
+
+            for (int localIndex = 0; localIndex < OCCA_ARRAY_TILE_SIZE; ++localIndex; @inner) {
+              const int index = (tile * OCCA_ARRAY_TILE_SIZE) + localIndex;
+              OCCA_ARRAY_SCAN_WRITE(tile, localIndex, index);
+            }
+          }
+        ));
+
+        if (step == 0) {
+          // Tiles start from the values before them
+          if (tileCount > 1) {
+            typelessScan(tileOffsets, tileOffsets, type, false, identity);
+          } else {
+            typelessScanIdentityFill(tileOffsets, identity);
+          }
+        }
+      }
+    }
+
+    // Sets the single entry of [mem] to [identity]
+    void typelessScanIdentityFill(occa::memory mem,
+                                  const std::string &identity) const {
+      occa::scope scope({
+        {"occa_array_output", mem}
+      }, {
+        {"defines/T", mem.dtype().name()},
+        {"defines/OCCA_ARRAY_SCAN_IDENTITY", identity}
+      });
+      scope.device = device_;
+
+      OCCA_JIT(scope, (
+        for (int i = 0; i < 1; ++i; @outer) {
+          for (int j = 0; j < 1; ++j; @inner) {
+            occa_array_output[0] = OCCA_ARRAY_SCAN_IDENTITY;
+          }
+        }
+      ));
+    }
+
+    // Replaces the 0/1 [flags] with their inclusive sum and returns the flag count
+    int typelessScanFlags(occa::memory flags) const {
+      const int arrayLength = (int) flags.length();
+      if (!arrayLength) {
+        return 0;
+      }
+
+      typelessScan(flags, flags, reductionType::sum, true, "0");
+
+      int flagCount = 0;
+      flags.copyTo(&flagCount, 1, arrayLength - 1);
+      return flagCount;
+    }
+
+    // Runs OCCA_ARRAY_SCATTER(POSITION, INDEX) from [scatterScope] for each
+    //   flagged index, where [positions] is the inclusive sum of the flags
+    void typelessScatterFlagged(occa::memory positions,
+                                const occa::scope &scatterScope) const {
+      occa::scope scope = getTiledLoopScope((int) positions.length());
+      scope.add("occa_array_positions", positions);
+
+      OCCA_JIT(scope + scatterScope, (
+        OCCA_ARRAY_TILE_FOR_LOOP {
+          OCCA_ARRAY_TILE_PARALLEL_FOR_LOOP {
+            const int position = occa_array_positions[i];
+            const int previousPosition = i ? occa_array_positions[i - 1] : 0;
+            if (position != previousPosition) {
+              OCCA_ARRAY_SCATTER(previousPosition, i);
+            }
+          }
+        }
+      ));
+    }
+
+    // Copies the [input] entries whose [positions] flag is set
+    occa::memory typelessCompact(occa::memory input,
+                                 occa::memory positions) const {
+      const int outputLength = typelessScanFlags(positions);
+
+      occa::memory output = device_.malloc(outputLength, input.dtype());
+      if (!outputLength) {
+        return output;
+      }
+
+      occa::scope scatterScope({
+        {"occa_array_input", input},
+        {"occa_array_output", output}
+      }, {
+        {"defines/OCCA_ARRAY_SCATTER(POSITION, INDEX)",
+         "occa_array_output[POSITION] = occa_array_input[INDEX]"}
+      });
+      typelessScatterFlagged(positions, scatterScope);
+
+      return output;
+    }
+
+    // Stable LSD radix sort with 8-bit digits on keys of [keyBytes] bytes
+    //   Each block is counted and scattered by one thread, which keeps the
+    //   scatter stable but leaves GPU threads idle. Not tuned for GPUs yet.
+    //   [keyType]: Unsigned type with the same size as the keys
+    //   [keyValue]: Maps the key bits to unsigned values with the same order
+    //   [values]: Moved along with the keys if initialized
+    void typelessRadixSort(occa::memory keys,
+                           occa::memory values,
+                           const int keyBytes,
+                           const std::string &keyType,
+                           const std::string &keyValue,
+                           occa::memory &sortedKeys,
+                           occa::memory &sortedValues) const {
+      const int arrayLength = (int) keys.length();
+      const int blockCount = getPrimitiveBlockCount(arrayLength, 256);
+      const bool hasValues = values.isInitialized();
+
+      occa::memory digitCounts = device_.malloc<int>(256 * blockCount);
+
+      occa::memory keyBuffers[2] = {
+        device_.malloc(arrayLength, keys.dtype()),
+        keyBytes > 1 ? device_.malloc(arrayLength, keys.dtype()) : occa::memory()
+      };
+      occa::memory valueBuffers[2];
+      if (hasValues) {
+        valueBuffers[0] = device_.malloc(arrayLength, values.dtype());
+        if (keyBytes > 1) {
+          valueBuffers[1] = device_.malloc(arrayLength, values.dtype());
+        }
+      }
+
+      occa::scope scope = getBlockedScope(arrayLength, blockCount);
+      scope.add("occa_array_counts", digitCounts);
+      scope.props["defines/OCCA_ARRAY_RADIX_KEY"] = keyType;
+      scope.props["defines/OCCA_ARRAY_RADIX_VALUE(KEY)"] = keyValue;
+      scope.props["defines/OCCA_ARRAY_RADIX_DIGIT(INDEX)"] = (
+        "((int) ((((OCCA_ARRAY_RADIX_KEY) OCCA_ARRAY_RADIX_VALUE((OCCA_ARRAY_RADIX_KEY) occa_array_keys[INDEX]))"
+        " >> occa_array_shift) & 255))"
+      );
+      if (hasValues) {
+        scope.props["defines/OCCA_ARRAY_RADIX_MOVE_VALUE(TO, FROM)"] = (
+          "occa_array_values_out[TO] = occa_array_values[FROM]"
+        );
+      } else {
+        scope.props["defines/OCCA_ARRAY_RADIX_MOVE_VALUE(TO, FROM)"] = "";
+      }
+
+      occa::memory passKeys = keys;
+      occa::memory passValues = values;
+      for (int pass = 0; pass < keyBytes; ++pass) {
+        occa::memory passSortedKeys = keyBuffers[pass % 2];
+        occa::memory passSortedValues = valueBuffers[pass % 2];
+
+        occa::scope passScope = scope;
+        passScope.add("occa_array_shift", 8 * pass);
+        passScope.add("occa_array_keys", passKeys);
+        passScope.add("occa_array_keys_out", passSortedKeys);
+        if (hasValues) {
+          passScope.add("occa_array_values", passValues);
+          passScope.add("occa_array_values_out", passSortedValues);
+        }
+
+        // Count the digits in each block, stored as [digit][block]
+        OCCA_JIT(passScope, (
+          for (int block = 0; block < occa_array_blocks; ++block; @outer) {
+            for (int dummyIndex = 0; dummyIndex < 1; ++dummyIndex; @inner) {
+              const int blockSize = (
+                (occa_array_length + occa_array_blocks - 1) / occa_array_blocks
+              );
+
+              const int startIndex = block * blockSize;
+              const int unsafeEndIndex = startIndex + blockSize;
+              const int endIndex = occa_array_length < unsafeEndIndex ? occa_array_length : unsafeEndIndex;
+
+              int localCounts[256];
+              for (int digit = 0; digit < 256; ++digit) {
+                localCounts[digit] = 0;
+              }
+
+              for (int i = startIndex; i < endIndex; ++i) {
+                ++localCounts[OCCA_ARRAY_RADIX_DIGIT(i)];
+              }
+
+              for (int digit = 0; digit < 256; ++digit) {
+                occa_array_counts[(digit * occa_array_blocks) + block] = localCounts[digit];
+              }
+            }
+          }
+        ));
+
+        // Where each block's digits start in the sorted keys
+        typelessScan(digitCounts, digitCounts, reductionType::sum, false, "0");
+
+        OCCA_JIT(passScope, (
+          for (int block = 0; block < occa_array_blocks; ++block; @outer) {
+            for (int dummyIndex = 0; dummyIndex < 1; ++dummyIndex; @inner) {
+              const int blockSize = (
+                (occa_array_length + occa_array_blocks - 1) / occa_array_blocks
+              );
+
+              const int startIndex = block * blockSize;
+              const int unsafeEndIndex = startIndex + blockSize;
+              const int endIndex = occa_array_length < unsafeEndIndex ? occa_array_length : unsafeEndIndex;
+
+              int localOffsets[256];
+              for (int digit = 0; digit < 256; ++digit) {
+                localOffsets[digit] = occa_array_counts[(digit * occa_array_blocks) + block];
+              }
+
+              for (int i = startIndex; i < endIndex; ++i) {
+                const int position = localOffsets[OCCA_ARRAY_RADIX_DIGIT(i)]++;
+                occa_array_keys_out[position] = occa_array_keys[i];
+                OCCA_ARRAY_RADIX_MOVE_VALUE(position, i);
+              }
+            }
+          }
+        ));
+
+        passKeys = passSortedKeys;
+        passValues = passSortedValues;
+      }
+
+      sortedKeys = passKeys;
+      sortedValues = passValues;
+    }
+
+    // Counts the [input] values in [minValue, maxValue] into [bins] equal bins
+    //   Like the radix sort, each block is counted by one thread
+    occa::memory typelessHistogram(occa::memory input,
+                                   const int bins,
+                                   const double minValue,
+                                   const double maxValue) const {
+      const int arrayLength = (int) input.length();
+      const int blockCount = getPrimitiveBlockCount(arrayLength, bins);
+
+      occa::memory blockCounts = device_.malloc<int>(bins * blockCount);
+      occa::memory counts = device_.malloc<int>(bins);
+
+      occa::scope scope = getBlockedScope(arrayLength, blockCount);
+      scope.add("occa_array_input", input);
+      scope.add("occa_array_block_counts", blockCounts);
+      scope.add("occa_array_bins", bins);
+      scope.add("occa_array_min", minValue);
+      scope.add("occa_array_max", maxValue);
+      scope.add("occa_array_scale", (
+        maxValue > minValue
+        ? bins / (maxValue - minValue)
+        : 0.0
+      ));
+      scope.props["defines/T"] = input.dtype().name();
+
+      OCCA_JIT(scope, (
+        for (int block = 0; block < occa_array_blocks; ++block; @outer) {
+          for (int dummyIndex = 0; dummyIndex < 1; ++dummyIndex; @inner) {
+            const int blockSize = (
+              (occa_array_length + occa_array_blocks - 1) / occa_array_blocks
+            );
+
+            const int startIndex = block * blockSize;
+            const int unsafeEndIndex = startIndex + blockSize;
+            const int endIndex = occa_array_length < unsafeEndIndex ? occa_array_length : unsafeEndIndex;
+
+            const int blockOffset = block * occa_array_bins;
+            for (int bin = 0; bin < occa_array_bins; ++bin) {
+              occa_array_block_counts[blockOffset + bin] = 0;
+            }
+
+            for (int i = startIndex; i < endIndex; ++i) {
+              const double value = (double) occa_array_input[i];
+              if ((occa_array_min <= value) && (value <= occa_array_max)) {
+                const int unsafeBin = (int) ((value - occa_array_min) * occa_array_scale);
+                const int bin = unsafeBin < occa_array_bins ? unsafeBin : (occa_array_bins - 1);
+                ++occa_array_block_counts[blockOffset + bin];
+              }
+            }
+          }
+        }
+      ));
+
+      // Loops over the bins
+      occa::scope binScope = getTiledLoopScope(bins);
+      binScope.add("occa_array_blocks", blockCount);
+      binScope.add("occa_array_block_counts", blockCounts);
+      binScope.add("occa_array_output", counts);
+
+      OCCA_JIT(binScope, (
+        OCCA_ARRAY_TILE_FOR_LOOP {
+          OCCA_ARRAY_TILE_PARALLEL_FOR_LOOP {
+            int count = 0;
+            for (int block = 0; block < occa_array_blocks; ++block) {
+              count += occa_array_block_counts[(block * occa_array_length) + i];
+            }
+            occa_array_output[i] = count;
+          }
+        }
+      ));
+
+      return counts;
+    }
+
+    // Reduces the [values] of each segment, which start at [segmentStarts]
+    occa::memory typelessSegmentedReduce(occa::memory values,
+                                         occa::memory segmentStarts,
+                                         reductionType type) const {
+      const int segmentCount = (int) segmentStarts.length();
+
+      occa::memory output = device_.malloc(segmentCount, values.dtype());
+
+      occa::scope scope = getTiledLoopScope(segmentCount);
+      scope.add("occa_array_value_count", (int) values.length());
+      scope.add("occa_array_starts", segmentStarts);
+      scope.add("occa_array_values", values);
+      scope.add("occa_array_output", output);
+      scope.props["defines/T2"] = values.dtype().name();
+      scope.props["defines/OCCA_ARRAY_LOCAL_REDUCTION(LEFT_VALUE, RIGHT_VALUE)"] = buildLocalReductionOperation(type);
+
+      OCCA_JIT(scope, (
+        OCCA_ARRAY_TILE_FOR_LOOP {
+          OCCA_ARRAY_TILE_PARALLEL_FOR_LOOP {
+            const int startIndex = occa_array_starts[i];
+            const int endIndex = (
+              (i + 1) < occa_array_length
+              ? occa_array_starts[i + 1]
+              : occa_array_value_count
+            );
+
+            T2 acc = occa_array_values[startIndex];
+            for (int j = startIndex + 1; j < endIndex; ++j) {
+              acc = (OCCA_ARRAY_LOCAL_REDUCTION(acc, occa_array_values[j]));
+            }
+            occa_array_output[i] = acc;
+          }
+        }
+      ));
+
+      return output;
+    }
+    //==================================
   };
 }
 
@@ -1,6 +1,10 @@
 #ifndef OCCA_FUNCTIONAL_UTILS_HEADER
 #define OCCA_FUNCTIONAL_UTILS_HEADER
 
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
 #include <occa/defines/macros.hpp>
 #include <occa/functional/types.hpp>
 #include <occa/functional/scope.hpp>
@@ -115,6 +119,53 @@ namespace occa {
       return reductionValue;
     }
 
+    // Source for the value that leaves others unchanged in the reduction,
+    //   used to start scans and reductions that can't start from a value
+    template <class T>
+    typename std::enable_if<std::is_arithmetic<T>::value, std::string>::type
+    reductionIdentity(reductionType type) {
+      typedef std::numeric_limits<T> limits;
+
+      std::stringstream ss;
+      ss.precision(limits::max_digits10);
+      switch (type) {
+        case reductionType::sum:
+        case reductionType::bitOr:
+        case reductionType::bitXor:
+        case reductionType::boolOr:
+          ss << 0;
+          break;
+        case reductionType::multiply:
+        case reductionType::boolAnd:
+          ss << 1;
+          break;
+        case reductionType::bitAnd:
+          ss << "(~0)";
+          break;
+        case reductionType::min:
+          ss << +limits::max();
+          break;
+        case reductionType::max:
+          if (limits::is_integer && limits::is_signed) {
+            // The lowest integer can't be written as a literal
+            ss << '(' << +(limits::lowest() + 1) << " - 1)";
+          } else {
+            ss << +limits::lowest();
+          }
+          break;
+        default:
+          break;
+      }
+      return ss.str();
+    }
+
+    // Other types don't have a known identity
+    template <class T>
+    typename std::enable_if<!std::is_arithmetic<T>::value, std::string>::type
+    reductionIdentity(reductionType type) {
+      return "";
+    }
+
     template <>
     bool hostReduction<bool>(reductionType type, occa::memory mem);
 
@@ -2,6 +2,7 @@
 #define OCCA_UTILS_JSON_HEADER
 
 #include <map>
+#include <new>
 #include <vector>
 
 #include <occa/dtype/builtins.hpp>
@@ -19,12 +20,16 @@ namespace occa {
   // TODO(v2.0): Remove occa::properties
   typedef json properties;
 
-  typedef struct {
+  // Only the member matching json::type is constructed
+  union jsonValue_t {
     primitive number;
     std::string string;
     jsonArray array;
     jsonObject object;
-  } jsonValue_t;
+
+    inline jsonValue_t() {}
+    inline ~jsonValue_t() {}
+  };
 
   /**
    * @startDoc{json}
@@ -141,98 +146,104 @@ namespace occa {
     type_t type;
     jsonValue_t value_;
 
-    inline json(type_t type_ = none_) {
-      clear();
-      type = type_;
+    inline json(type_t type_ = none_) :
+      type(none_) {
+      setType(type_);
     }
 
     inline json(const json &j) :
-      type(j.type),
-      value_(j.value_) {}
+      type(none_) {
+      copyValue(j);
+    }
+
+    inline json(json &&j) :
+      type(none_) {
+      moveValue(j);
+    }
 
     inline json(const bool value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const uint8_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const int8_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const uint16_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const int16_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const uint32_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const int32_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const uint64_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const int64_t value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const float value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const double value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const primitive &value) :
       type(number_) {
-      value_.number = value;
+      new (&value_.number) primitive(value);
     }
 
     inline json(const char *value) :
       type(string_) {
-      value_.string = value;
+      new (&value_.string) std::string(value);
     }
 
     inline json(const std::string &value) :
       type(string_) {
-      value_.string = value;
+      new (&value_.string) std::string(value);
     }
 
     inline json(const hash_t &value) :
       type(string_) {
-      value_.string = value.getFullString();
+      new (&value_.string) std::string(value.getFullString());
     }
 
     inline json(const jsonObject &value) :
       type(object_) {
-      value_.object = value;
+      new (&value_.object) jsonObject(value);
     }
 
     inline json(const jsonArray &value) :
       type(array_) {
-      value_.array = value;
+      new (&value_.array) jsonArray(value);
     }
 
     json(const std::string &name,
@@ -245,105 +256,106 @@ namespace occa {
     json& clear();
 
     json& operator = (const json &j);
+    json& operator = (json &&j);
 
     inline json& operator = (const char *c) {
-      type = string_;
+      setType(string_);
       value_.string = c;
       return *this;
     }
 
     inline json& operator = (const std::string &value) {
-      type = string_;
+      setType(string_);
       value_.string = value;
       return *this;
     }
 
     inline json& operator = (const bool value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const uint8_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const int8_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const uint16_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const int16_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const uint32_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const int32_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const uint64_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const int64_t value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const float value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const double value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const primitive &value) {
-      type = number_;
+      setType(number_);
       value_.number = value;
       return *this;
     }
 
     inline json& operator = (const hash_t &value) {
-      type = string_;
+      setType(string_);
       value_.string = value.getFullString();
       return *this;
     }
 
     inline json& operator = (const jsonObject &value) {
-      type = object_;
+      setType(object_);
       value_.object = value;
       return *this;
     }
 
     inline json& operator = (const jsonArray &value) {
-      type = array_;
+      setType(array_);
       value_.array = value;
       return *this;
     }
@@ -538,11 +550,7 @@ namespace occa {
      * @endDoc
      */
     inline json& asNull() {
-      if (type & ~(none_ | null_)) {
-        clear();
-      }
-      type = null_;
-      return *this;
+      return setType(null_);
     }
 
     /**
@@ -557,8 +565,7 @@ namespace occa {
       if (type & number_) {
         value_.number = (bool) value_.number;
       } else {
-        clear();
-        type = number_;
+        setType(number_);
         value_.number = false;
       }
       return *this;
@@ -573,11 +580,7 @@ namespace occa {
      * @endDoc
      */
     inline json& asNumber() {
-      if (type & ~(none_ | number_)) {
-        clear();
-      }
-      type = number_;
-      return *this;
+      return setType(number_);
     }
 
     /**
@@ -589,11 +592,7 @@ namespace occa {
      * @endDoc
      */
     inline json& asString() {
-      if (type & ~(none_ | string_)) {
-        clear();
-      }
-      type = string_;
-      return *this;
+      return setType(string_);
     }
 
     /**
@@ -605,11 +604,7 @@ namespace occa {
      * @endDoc
      */
     inline json& asArray() {
-      if (type & ~(none_ | array_)) {
-        clear();
-      }
-      type = array_;
-      return *this;
+      return setType(array_);
     }
 
     /**
@@ -621,51 +616,47 @@ namespace occa {
      * @endDoc
      */
     inline json& asObject() {
-      if (type & ~(none_ | object_)) {
-        clear();
-      }
-      type = object_;
-      return *this;
+      return setType(object_);
     }
 
     inline bool& boolean() {
-      return value_.number.value.bool_;
+      return valueAs(number_).value_.number.value.bool_;
     }
 
     inline primitive& number() {
-      return value_.number;
+      return valueAs(number_).value_.number;
     }
 
     inline std::string& string() {
-      return value_.string;
+      return valueAs(string_).value_.string;
     }
 
     inline jsonArray& array() {
-      return value_.array;
+      return valueAs(array_).value_.array;
     }
 
     inline jsonObject& object() {
-      return value_.object;
+      return valueAs(object_).value_.object;
     }
 
     inline bool boolean() const {
-      return value_.number;
+      return valueAs(number_).value_.number;
     }
 
     inline const primitive& number() const {
-      return value_.number;
+      return valueAs(number_).value_.number;
     }
 
     inline const std::string& string() const {
-      return value_.string;
+      return valueAs(string_).value_.string;
     }
 
     inline const jsonArray& array() const {
-      return value_.array;
+      return valueAs(array_).value_.array;
     }
 
     inline const jsonObject& object() const {
-      return value_.object;
+      return valueAs(object_).value_.object;
     }
 
     json& operator [] (const char *c);
@@ -743,6 +734,9 @@ namespace occa {
 
     json getPathValue(const char *key) const;
 
+    // Same as getPathValue but without copying, returns NULL if missing
+    const json* findPath(const char *key) const;
+
     /**
      * @startDoc{get[0]}
      *
@@ -950,6 +944,69 @@ namespace occa {
 
     friend std::ostream& operator << (std::ostream &out,
                                       const json &j);
+
+  private:
+    inline json& setType(const type_t type_) {
+      if (type != type_) {
+        destroyValue();
+        initValue(type_);
+      }
+      return *this;
+    }
+
+    inline void initValue(const type_t type_) {
+      switch (type_) {
+        case number_:
+          new (&value_.number) primitive(0);
+          break;
+        case string_:
+          new (&value_.string) std::string();
+          break;
+        case array_:
+          new (&value_.array) jsonArray();
+          break;
+        case object_:
+          new (&value_.object) jsonObject();
+          break;
+        default:
+          break;
+      }
+      type = type_;
+    }
+
+    inline void destroyValue() {
+      switch (type) {
+        case number_:
+          value_.number.~primitive();
+          break;
+        case string_:
+          value_.string.~basic_string();
+          break;
+        case array_:
+          value_.array.~jsonArray();
+          break;
+        case object_:
+          value_.object.~jsonObject();
+          break;
+        default:
+          break;
+      }
+      type = none_;
+    }
+
+    void copyValue(const json &j);
+    void moveValue(json &j);
+
+    inline json& valueAs(const type_t type_) {
+      return (type == type_) ? *this : mismatchedValue(type_);
+    }
+
+    inline const json& valueAs(const type_t type_) const {
+      return (type == type_) ? *this : emptyValue(type_);
+    }
+
+    json& mismatchedValue(const type_t type_);
+    static const json& emptyValue(const type_t type_);
   };
 
   class jsonKeyValue {
@@ -2,7 +2,7 @@ namespace occa {
   template <class T>
   json& json::set(const char *key,
                   const T &value) {
-    type = object_;
+    setType(object_);
     value_.object[key] = value;
     return *this;
   }
@@ -16,9 +16,9 @@ namespace occa {
   template <class T>
   T json::get(const char *key,
                const T &default_) const {
-    const json value = getPathValue(key);
-    if (value.isInitialized()) {
-      return (T) value;
+    const json *value = findPath(key);
+    if (value && value->isInitialized()) {
+      return (T) *value;
     }
     return default_;
   }
@@ -45,12 +45,13 @@ namespace occa {
   template <class T>
   std::vector<T> json::toVector(const char *c,
                                  const std::vector<T> &default_) const {
-    return getPathValue(c).toVector<T>(default_);
+    const json *value = findPath(c);
+    return value ? value->toVector<T>(default_) : default_;
   }
 
   template <class T>
   std::vector<T> json::toVector(const std::string &s,
                                  const std::vector<T> &default_) const {
-    return getPathValue(s.c_str()).toVector<T>(default_);
+    return toVector<T>(s.c_str(), default_);
   }
 }
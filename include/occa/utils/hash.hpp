@@ -18,7 +18,7 @@ namespace occa {
    *   An object used to represent a hash value.
    *   It's intent isn't for security purposes, but rather to distinguish "things".
    *
-   *   > It currently uses FNV hashing since it's quick, but it can be changed if something more useful shows up.
+   *   > It currently uses a 4-lane 64-bit hash (xxHash64 rounds) producing 256 bits since it's quick, but it can be changed if something more useful shows up.
    *
    * @endDoc
    */
@@ -27,6 +27,7 @@
 #define OCCA_OPENCL_ENABLED @@OCCA_OPENCL_ENABLED@@
 #define OCCA_METAL_ENABLED  @@OCCA_METAL_ENABLED@@
 #define OCCA_DPCPP_ENABLED @@OCCA_DPCPP_ENABLED@@
+#define OCCA_CLANG_JIT_ENABLED @@OCCA_CLANG_JIT_ENABLED@@
 
 #define OCCA_THREAD_SHARABLE_ENABLED @@OCCA_THREAD_SHARABLE_ENABLED@@
 #define OCCA_MAX_ARGS @@OCCA_MAX_ARGS@@
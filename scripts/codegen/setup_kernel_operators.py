@@ -67,7 +67,7 @@ def operator_args(N, indent, argtype, argname=None):
 def array_args(N, indent):
     content = ''
     for n in range(1, N + 1):
-        content += 'arg{n}'.format(n=n)
+        content += '&arg{n}'.format(n=n)
         if n < N:
             if n % 10:
                 content += ', '
@@ -135,7 +135,7 @@ def operator_definition(N):
     if N > 0:
         content += ''') const {{
   assertInitialized();
-  kernelArg args[] = {{
+  const kernelArg *args[] = {{
     {array_args}
   }};
   modeKernel->setArguments(args, {N});
@@ -171,4 +171,52 @@ void occaKernelRunWithArgs(occaKernel kernel,
   kernel_.run();
 }
 
+//---[ Bound Kernel ]-------------------
+occaBoundKernel occaCreateBoundKernel(occaKernel kernel) {
+  occa::boundKernel *boundKernel = new occa::boundKernel(
+    occa::c::kernel(kernel)
+  );
+  return occa::c::newOccaType(*boundKernel);
+}
+
+int occaBoundKernelArgumentIndex(occaBoundKernel boundKernel,
+                                 const char *name) {
+  return occa::c::boundKernel(boundKernel).argumentIndex(name);
+}
+
+void occaBoundKernelBindArg(occaBoundKernel boundKernel,
+                            const int index,
+                            occaType arg) {
+  occa::c::boundKernel(boundKernel).bind(
+    index,
+    occa::c::kernelArg(arg)
+  );
+}
+
+void occaBoundKernelBindNamedArg(occaBoundKernel boundKernel,
+                                 const char *name,
+                                 occaType arg) {
+  occa::c::boundKernel(boundKernel).bind(
+    std::string(name),
+    occa::c::kernelArg(arg)
+  );
+}
+
+void occaBoundKernelBindArgs(occaBoundKernel boundKernel,
+                             const int argc,
+                             occaType *args) {
+  occa::boundKernel &boundKernel_ = occa::c::boundKernel(boundKernel);
+  for (int i = 0; i < argc; ++i) {
+    boundKernel_.bind(
+      i,
+      occa::c::kernelArg(args[i])
+    );
+  }
+}
+
+void occaBoundKernelLaunch(occaBoundKernel boundKernel) {
+  occa::c::boundKernel(boundKernel).launch();
+}
+//======================================
+
 OCCA_END_EXTERN_C
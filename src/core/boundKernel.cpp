@@ -0,0 +1,128 @@
+#include <occa/core/boundKernel.hpp>
+#include <occa/internal/core/device.hpp>
+#include <occa/internal/core/graph.hpp>
+#include <occa/internal/core/kernel.hpp>
+
+namespace occa {
+  boundKernel::boundKernel() :
+    boundCount(0) {}
+
+  boundKernel::boundKernel(const occa::kernel &kernel__) :
+    kernel_(kernel__),
+    boundCount(0) {
+    modeKernel_t *modeKernel = kernel_.getModeKernel();
+    if (modeKernel && modeKernel->metadata.isInitialized()) {
+      const int argc = (int) modeKernel->metadata.arguments.size();
+      arguments.resize(argc);
+      memoryRefs.resize(argc);
+      isBound.resize(argc, false);
+    }
+  }
+
+  void boundKernel::assertInitialized() const {
+    OCCA_ERROR("Bound kernel not initialized or its kernel has been freed",
+               kernel_.getModeKernel() != NULL);
+  }
+
+  bool boundKernel::isInitialized() const {
+    return (kernel_.getModeKernel() != NULL);
+  }
+
+  occa::kernel boundKernel::getKernel() const {
+    return kernel_;
+  }
+
+  int boundKernel::argumentCount() const {
+    return (int) arguments.size();
+  }
+
+  int boundKernel::argumentIndex(const std::string &name) const {
+    modeKernel_t *modeKernel = kernel_.getModeKernel();
+    if (!modeKernel) {
+      return -1;
+    }
+
+    const std::vector<lang::argMetadata_t> &metaArgs = modeKernel->metadata.arguments;
+    const int argc = (int) metaArgs.size();
+    for (int i = 0; i < argc; ++i) {
+      if (metaArgs[i].name == name) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void boundKernel::bind(const int index, const kernelArg &arg) {
+    assertInitialized();
+
+    modeKernel_t &modeKernel = *(kernel_.getModeKernel());
+    const bool hasMetadata = modeKernel.metadata.isInitialized();
+
+    OCCA_ERROR("(" << modeKernel.name << ") Argument index [" << index << "] is out of bounds",
+               (index >= 0)
+               && ((index + 1) < OCCA_MAX_ARGS)
+               && (!hasMetadata || (index < (int) arguments.size())));
+
+    OCCA_ERROR("(" << modeKernel.name << ") Bound argument [" << index << "] must be a single value",
+               arg.size() == 1);
+
+    const kernelArgData &argData = arg[0];
+    modeKernel.assertArgInDevice(argData, index);
+    if (modeKernel.validatesTypes()) {
+      modeKernel.assertArgType(argData, index);
+    }
+
+    if (index >= (int) arguments.size()) {
+      arguments.resize(index + 1);
+      memoryRefs.resize(index + 1);
+      isBound.resize(index + 1, false);
+    }
+
+    arguments[index] = argData;
+    memoryRefs[index] = (
+      argData.modeMemory
+      ? occa::memory(argData.modeMemory)
+      : occa::memory()
+    );
+    if (!isBound[index]) {
+      isBound[index] = true;
+      ++boundCount;
+    }
+  }
+
+  void boundKernel::bind(const std::string &name, const kernelArg &arg) {
+    assertInitialized();
+
+    const int index = argumentIndex(name);
+    OCCA_ERROR("(" << kernel_.getModeKernel()->name << ") Kernel has no argument named [" << name << "]",
+               index >= 0);
+
+    bind(index, arg);
+  }
+
+  void boundKernel::launch() {
+    assertInitialized();
+
+    const int argc = (int) arguments.size();
+    if (boundCount < argc) {
+      for (int i = 0; i < argc; ++i) {
+        OCCA_ERROR("(" << kernel_.getModeKernel()->name << ") Argument [" << i << "] has not been bound",
+                   isBound[i]);
+      }
+    }
+
+    modeKernel_t &modeKernel = *(kernel_.getModeKernel());
+    if (modeKernel.isNoop()) {
+      return;
+    }
+
+    modeGraph_t *capturingGraph = modeKernel.modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addKernel(&modeKernel, arguments);
+      return;
+    }
+
+    // Arguments were validated when bound, so they're launched directly
+    modeKernel.runWith(arguments);
+  }
+}
@@ -1,12 +1,14 @@
 #include <occa/core/device.hpp>
 #include <occa/core/base.hpp>
 #include <occa/internal/core/device.hpp>
+#include <occa/internal/core/graph.hpp>
 #include <occa/internal/core/kernel.hpp>
 #include <occa/internal/core/memory.hpp>
 #include <occa/internal/core/memoryPool.hpp>
 #include <occa/internal/modes.hpp>
 #include <occa/internal/utils/sys.hpp>
 #include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/threadPool.hpp>
 #include <occa/internal/io.hpp>
 
 namespace occa {
@@ -219,6 +221,28 @@ namespace occa {
     );
   }
 
+  resolvedProperties device::resolveMemoryProperties(const occa::json &props) const {
+    return resolvedProperties(modeDevice,
+                              resolvedProperties::memory_,
+                              memoryProperties(props));
+  }
+
+  resolvedProperties device::resolveKernelProperties(const occa::json &props) const {
+    occa::json kernelProps = kernelProperties(props);
+    // Everything in baseKernelHash except the source hash
+    const hash_t kernelHash = baseKernelHash(kernelProps, hash_t());
+    return resolvedProperties(modeDevice,
+                              resolvedProperties::kernel_,
+                              std::move(kernelProps),
+                              kernelHash);
+  }
+
+  resolvedProperties device::resolveStreamProperties(const occa::json &props) const {
+    return resolvedProperties(modeDevice,
+                              resolvedProperties::stream_,
+                              streamProperties(props));
+  }
+
   hash_t device::hash() const {
     if (modeDevice) {
       return modeDevice->versionedHash();
@@ -247,6 +271,20 @@ namespace occa {
     return 0;
   }
 
+  udim_t device::kernelCacheHits() const {
+    if (modeDevice) {
+      return modeDevice->kernelCacheHits;
+    }
+    return 0;
+  }
+
+  udim_t device::kernelCacheMisses() const {
+    if (modeDevice) {
+      return modeDevice->kernelCacheMisses;
+    }
+    return 0;
+  }
+
   void device::finish() {
     if (modeDevice) {
       modeDevice->finish();
@@ -270,6 +308,12 @@ namespace occa {
     return modeDevice->createStream(streamProperties(props));
   }
 
+  stream device::createStream(const resolvedProperties &props) {
+    assertInitialized();
+    props.assertResolvedFor(modeDevice, resolvedProperties::stream_);
+    return modeDevice->createStream(props.properties());
+  }
+
   stream device::wrapStream(void* ptr, const occa::json &props) {
     assertInitialized();
 
@@ -290,11 +334,19 @@ namespace occa {
 
   streamTag device::tagStream() {
     assertInitialized();
+    // Captured tags are only created when the graph is replayed
+    if (modeDevice->capturingGraph) {
+      modeDevice->capturingGraph->addTag();
+      return streamTag();
+    }
     return modeDevice->tagStream();
   }
 
   void device::waitFor(streamTag tag) {
     assertInitialized();
+    OCCA_ERROR("Stream tag is not initialized, tags created while capturing"
+               " are found in graph::tags() after replaying",
+               tag.isInitialized());
     modeDevice->waitFor(tag);
   }
 
@@ -304,6 +356,33 @@ namespace occa {
   }
   //  |=================================
 
+  //  |---[ Graph ]---------------------
+  void device::beginCapture(const occa::json &props) {
+    assertInitialized();
+    OCCA_ERROR("Device is already capturing a graph",
+               modeDevice->capturingGraph == NULL);
+
+    modeDevice->capturingGraph = new modeGraph_t(modeDevice, props);
+  }
+
+  graph device::endCapture() {
+    assertInitialized();
+    OCCA_ERROR("Device is not capturing a graph",
+               modeDevice->capturingGraph != NULL);
+
+    graph capturedGraph(modeDevice->capturingGraph);
+    modeDevice->capturingGraph = NULL;
+
+    capturedGraph.getModeGraph()->instantiate();
+    return capturedGraph;
+  }
+
+  bool device::isCapturing() const {
+    return (modeDevice
+            && modeDevice->capturingGraph);
+  }
+  //  |=================================
+
   //  |---[ Kernel ]--------------------
   void device::setupKernelInfo(const occa::json &props,
                                const hash_t &sourceHash,
@@ -312,15 +391,21 @@ namespace occa {
     assertInitialized();
 
     kernelProps = kernelProperties(props);
+    kernelHash = applyDependencyHash(
+      baseKernelHash(kernelProps, sourceHash)
+    );
+  }
+
+  hash_t device::baseKernelHash(const occa::json &kernelProps,
+                                const hash_t &sourceHash) const {
+    assertInitialized();
 
-    kernelHash = (
+    return (
       hash()
       ^ modeDevice->kernelHash(kernelProps)
       ^ kernelHeaderHash(kernelProps)
       ^ sourceHash
     );
-
-    kernelHash = applyDependencyHash(kernelHash);
   }
 
   hash_t device::applyDependencyHash(const hash_t &kernelHash) const {
@@ -371,44 +456,118 @@ namespace occa {
   kernel device::buildKernel(const std::string &filename,
                              const std::string &kernelName,
                              const occa::json &props) const {
-    occa::json allProps;
-    hash_t kernelHash;
+    assertInitialized();
+
+    // Only the kernel hash is needed, skip hashing all properties
+    const occa::json kernelProps = kernelProperties(props);
+    return buildKernelWithProperties(filename,
+                                     kernelName,
+                                     kernelProps,
+                                     baseKernelHash(kernelProps, hash_t()));
+  }
+
+  kernel device::buildKernel(const std::string &filename,
+                             const std::string &kernelName,
+                             const resolvedProperties &props) const {
+    assertInitialized();
+    props.assertResolvedFor(modeDevice, resolvedProperties::kernel_);
+
+    return buildKernelWithProperties(filename,
+                                     kernelName,
+                                     props.data->props,
+                                     props.data->kernelHash);
+  }
+
+  kernel device::buildKernelWithProperties(const std::string &filename,
+                                           const std::string &kernelName,
+                                           const occa::json &kernelProps,
+                                           const hash_t &propsHash) const {
+    // Check cache first, without touching the filesystem
+    //   Edits to the source or its headers are found once the cached kernel is released
+    hash_t sourceHash = propsHash ^ occa::hash(filename);
+    for (const std::string &path : env::OCCA_KERNEL_PATH) {
+      sourceHash ^= occa::hash(path);
+    }
+    kernel cachedKernel = modeDevice->getCachedSourceKernel(sourceHash,
+                                                            kernelName);
+    if (cachedKernel.isInitialized()) {
+      return cachedKernel;
+    }
+
     const std::string realFilename = io::findInPaths(filename, env::OCCA_KERNEL_PATH);
-    setupKernelInfo(props, hashFile(realFilename),
-                    allProps, kernelHash);
+    const hash_t baseHash = (
+      propsHash
+      ^ hashFile(realFilename)
+    );
 
-    // TODO: [#185] Fix kernel cache frees
-    // // Check cache first
-    // kernel &cachedKernel = modeDevice->getCachedKernel(kernelHash,
-    //                                                    kernelName);
-    // if (cachedKernel.isInitialized()) {
-    //   return cachedKernel;
-    // }
+    // Kernels are keyed after applying dependency hashes so edited headers
+    //   don't return stale kernels
+    const hash_t kernelHash = applyDependencyHash(baseHash);
+    modeDevice->cacheSourceKernelHash(sourceHash, kernelHash);
+    cachedKernel = modeDevice->getCachedKernel(kernelHash,
+                                               kernelName);
+    if (cachedKernel.isInitialized()) {
+      return cachedKernel;
+    }
 
     const std::string hashDir = io::hashDir(realFilename, kernelHash);
+    occa::json allProps = kernelProps;
     allProps["hash"] = kernelHash.getFullString();
 
-    kernel cachedKernel = modeDevice->buildKernel(realFilename,
-                                                  kernelName,
-                                                  kernelHash,
-                                                  allProps);
+    cachedKernel = modeDevice->buildKernel(realFilename,
+                                           kernelName,
+                                           kernelHash,
+                                           allProps);
 
-    if (cachedKernel.isInitialized()) {
-      cachedKernel.modeKernel->hash = kernelHash;
-    } else {
+    if (!cachedKernel.isInitialized()) {
       sys::rmrf(hashDir);
+      return cachedKernel;
     }
 
-    return cachedKernel;
+    cachedKernel.modeKernel->hash = kernelHash;
+
+    return modeDevice->cacheKernel(kernelHash,
+                                   kernelName,
+                                   cachedKernel);
   }
 
   kernel device::buildKernelFromString(const std::string &content,
                                        const std::string &kernelName,
                                        const occa::json &props) const {
-    occa::json allProps;
-    hash_t kernelHash;
-    setupKernelInfo(props, occa::hash(content),
-                    allProps, kernelHash);
+    assertInitialized();
+
+    const occa::json kernelProps = kernelProperties(props);
+    return buildKernelFromStringWithProperties(content,
+                                               kernelName,
+                                               kernelProps,
+                                               baseKernelHash(kernelProps, hash_t()));
+  }
+
+  kernel device::buildKernelFromString(const std::string &content,
+                                       const std::string &kernelName,
+                                       const resolvedProperties &props) const {
+    assertInitialized();
+    props.assertResolvedFor(modeDevice, resolvedProperties::kernel_);
+
+    return buildKernelFromStringWithProperties(content,
+                                               kernelName,
+                                               props.data->props,
+                                               props.data->kernelHash);
+  }
+
+  kernel device::buildKernelFromStringWithProperties(const std::string &content,
+                                                     const std::string &kernelName,
+                                                     const occa::json &kernelProps,
+                                                     const hash_t &propsHash) const {
+    // Check cache first, without touching the filesystem
+    const hash_t sourceHash = propsHash ^ occa::hash(content);
+    kernel cachedKernel = modeDevice->getCachedSourceKernel(sourceHash,
+                                                            kernelName);
+    if (cachedKernel.isInitialized()) {
+      return cachedKernel;
+    }
+
+    const hash_t kernelHash = applyDependencyHash(sourceHash);
 
     std::string stringSourceFile = (
       io::hashDir(kernelHash)
@@ -424,9 +583,69 @@ namespace occa {
       }
     );
 
-    return buildKernel(stringSourceFile,
-                       kernelName,
-                       props);
+    cachedKernel = buildKernelWithProperties(stringSourceFile,
+                                             kernelName,
+                                             kernelProps,
+                                             propsHash);
+    if (cachedKernel.isInitialized()) {
+      modeDevice->cacheSourceKernelHash(sourceHash, cachedKernel.modeKernel->hash);
+    }
+    return cachedKernel;
+  }
+
+  kernelVector device::buildKernels(const kernelBuildInfoVector &builds,
+                                    const occa::json &props) const {
+    assertInitialized();
+
+    const int buildCount = (int) builds.size();
+    kernelVector kernels(buildCount);
+
+    // Group builds sharing the same kernel hash since they compile the same binary
+    std::map<hash_t, std::vector<int>> hashBuilds;
+    for (int i = 0; i < buildCount; ++i) {
+      const kernelBuildInfo &build = builds[i];
+      const std::string realFilename = io::findInPaths(build.filename, env::OCCA_KERNEL_PATH);
+      hashBuilds[
+        baseKernelHash(kernelProperties(build.props),
+                       hashFile(realFilename))
+      ].push_back(i);
+    }
+
+    std::vector<const std::vector<int>*> groups;
+    for (auto &it : hashBuilds) {
+      groups.push_back(&(it.second));
+    }
+    const int groupCount = (int) groups.size();
+
+    auto buildGroup = [&](const int group, const int thread) {
+      for (const int i : *(groups[group])) {
+        const kernelBuildInfo &build = builds[i];
+        kernels[i] = buildKernel(build.filename,
+                                 build.kernelName,
+                                 build.props);
+      }
+    };
+
+    if (!groupCount) {
+      return kernels;
+    }
+
+    // The first group is built alone to warm up per-compiler caches
+    //   (e.g. compiler vendor and flag checks) shared by all builds
+    buildGroup(0, 0);
+
+    int threadCount = 1;
+    if (modeDevice->canBuildKernelsConcurrently()) {
+      threadCount = props.get("threads", threadPool::defaultThreadCount());
+      threadCount = std::max(1, std::min(threadCount, groupCount - 1));
+    }
+
+    threadPool pool(threadCount);
+    pool.run(groupCount - 1, [&](const int group, const int thread) {
+      buildGroup(group + 1, thread);
+    });
+
+    return kernels;
   }
 
   kernel device::buildKernelFromBinary(const std::string &filename,
@@ -451,19 +670,43 @@ namespace occa {
       return memory();
     }
 
+    return mallocWithProperties(entries, dtype, src,
+                                memoryProperties(props));
+  }
+
+  occa::memory device::malloc(const dim_t entries,
+                              const dtype_t &dtype,
+                              const void *src,
+                              const resolvedProperties &props) {
+    assertInitialized();
+    props.assertResolvedFor(modeDevice, resolvedProperties::memory_);
+
+    if (entries == 0) {
+      return memory();
+    }
+
+    return mallocWithProperties(entries, dtype, src,
+                                props.properties());
+  }
+
+  occa::memory device::malloc(const dim_t entries,
+                              const dtype_t &dtype,
+                              const resolvedProperties &props) {
+    return malloc(entries, dtype, NULL, props);
+  }
+
+  occa::memory device::mallocWithProperties(const dim_t entries,
+                                            const dtype_t &dtype,
+                                            const void *src,
+                                            const occa::json &memProps) {
     const dim_t bytes = entries * dtype.bytes();
     OCCA_ERROR("Trying to allocate negative bytes (" << bytes << ")",
                bytes >= 0);
 
-    occa::json memProps = memoryProperties(props);
-
     memory mem(modeDevice->malloc(bytes, src, memProps));
     mem.setDtype(dtype);
 
-    modeDevice->bytesAllocated += bytes;
-    modeDevice->maxBytesAllocated = std::max(
-      modeDevice->maxBytesAllocated, modeDevice->bytesAllocated
-    );
+    modeDevice->addBytesAllocated(bytes);
 
     return mem;
   }
@@ -505,6 +748,19 @@ namespace occa {
     return malloc(entries, dtype::byte, NULL, props);
   }
 
+  template <>
+  memory device::malloc<void>(const dim_t entries,
+                              const void *src,
+                              const resolvedProperties &props) {
+    return malloc(entries, dtype::byte, src, props);
+  }
+
+  template <>
+  memory device::malloc<void>(const dim_t entries,
+                              const resolvedProperties &props) {
+    return malloc(entries, dtype::byte, NULL, props);
+  }
+
   template <>
   occa::memory device::wrapMemory<void>(const void *ptr,
                                         const dim_t entries,
@@ -0,0 +1,60 @@
+#include <occa/core/graph.hpp>
+#include <occa/internal/core/graph.hpp>
+
+namespace occa {
+  graph::graph() {}
+
+  graph::graph(modeGraph_t *modeGraph_) :
+    modeGraph(modeGraph_) {}
+
+  void graph::assertInitialized() const {
+    OCCA_ERROR("Graph not initialized or has been freed",
+               modeGraph.get() != NULL);
+  }
+
+  bool graph::isInitialized() const {
+    return (modeGraph.get() != NULL);
+  }
+
+  modeGraph_t* graph::getModeGraph() const {
+    return modeGraph.get();
+  }
+
+  occa::device graph::getDevice() const {
+    return (modeGraph
+            ? modeGraph->device
+            : occa::device());
+  }
+
+  int graph::size() const {
+    return (modeGraph
+            ? (int) modeGraph->nodes.size()
+            : 0);
+  }
+
+  int graph::depth() const {
+    return (modeGraph
+            ? (int) modeGraph->levels.size()
+            : 0);
+  }
+
+  bool graph::isConcurrent() const {
+    return (modeGraph && modeGraph->concurrent);
+  }
+
+  void graph::replay() {
+    assertInitialized();
+    modeGraph->replay();
+  }
+
+  const std::vector<streamTag>& graph::tags() const {
+    static const std::vector<streamTag> noTags;
+    return (modeGraph
+            ? modeGraph->tags
+            : noTags);
+  }
+
+  void graph::free() {
+    modeGraph.reset();
+  }
+}
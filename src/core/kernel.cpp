@@ -3,6 +3,7 @@
 #include <occa/core/memory.hpp>
 #include <occa/internal/io.hpp>
 #include <occa/internal/core/device.hpp>
+#include <occa/internal/core/graph.hpp>
 #include <occa/internal/core/kernel.hpp>
 #include <occa/internal/lang/builtins/types.hpp>
 #include <occa/internal/lang/parser.hpp>
@@ -57,8 +58,7 @@ namespace occa {
     if (!modeKernel) {
       return;
     }
-    modeKernel->removeKernelRef(this);
-    if (modeKernel->modeKernel_t::needsFree()) {
+    if (modeKernel->modeKernel_t::releaseKernelRef(this)) {
       free();
     }
   }
@@ -176,6 +176,13 @@ namespace occa {
     }
 
     modeKernel->setupRun();
+
+    modeGraph_t *capturingGraph = modeKernel->modeDevice->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addKernel(modeKernel, modeKernel->arguments);
+      return;
+    }
+
     modeKernel->run();
   }
 
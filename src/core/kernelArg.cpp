@@ -58,6 +58,44 @@ namespace occa {
 
   //====================================
 
+  //---[ inlineKernelArgDataVector ]----
+  inlineKernelArgDataVector::inlineKernelArgDataVector() :
+      count(0) {}
+
+  void inlineKernelArgDataVector::reserve(const size_type capacity_) {
+    if (capacity_ > 1) {
+      heapData.reserve(capacity_);
+    }
+  }
+
+  void inlineKernelArgDataVector::push_back(const kernelArgData &arg) {
+    if (!count) {
+      inlineData = arg;
+    } else {
+      if (count == 1) {
+        heapData.push_back(inlineData);
+      }
+      heapData.push_back(arg);
+    }
+    ++count;
+  }
+
+  void inlineKernelArgDataVector::pop_back() {
+    --count;
+    if (count == 1) {
+      inlineData = heapData[0];
+      heapData.clear();
+    } else if (count > 1) {
+      heapData.pop_back();
+    }
+  }
+
+  void inlineKernelArgDataVector::clear() {
+    count = 0;
+    heapData.clear();
+  }
+  //====================================
+
   //---[ kernelArg ]--------------------
   kernelArg::kernelArg() {}
 
@@ -156,14 +194,14 @@ namespace occa {
 
   void kernelArg::addMemory(modeMemory_t *arg) {
     if (!arg || !arg->size) {
-      add(nullptr);
+      args.push_back((primitive) nullptr);
       return;
     }
 
     // Set the modeMemory origin
     kernelArgData kArg(arg->getKernelArgPtr());
     kArg.modeMemory = arg;
-    add(kArg);
+    args.push_back(kArg);
   }
 
   int kernelArg::argumentCount(const std::vector<kernelArg> &arguments) {
@@ -2,6 +2,7 @@
 #include <occa/core/memory.hpp>
 #include <occa/core/device.hpp>
 #include <occa/internal/core/device.hpp>
+#include <occa/internal/core/graph.hpp>
 #include <occa/internal/core/memory.hpp>
 #include <occa/internal/utils/sys.hpp>
 
@@ -207,6 +208,12 @@ namespace occa {
                << " trying to access [" << offset_ << ", " << (offset_ + bytes) << "]",
                udim_t(bytes + offset_) <= modeMemory->size);
 
+    modeGraph_t *capturingGraph = modeMemory->getModeDevice()->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopyFromHost(modeMemory, src, bytes, offset_, props);
+      return;
+    }
+
     modeMemory->copyFrom(src, bytes, offset_, props);
   }
 
@@ -240,6 +247,12 @@ namespace occa {
                << " trying to access [" << destOffset_ << ", " << (destOffset_ + bytes) << "]",
                udim_t(bytes + destOffset_) <= modeMemory->size);
 
+    modeGraph_t *capturingGraph = modeMemory->getModeDevice()->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopy(modeMemory, src.modeMemory, bytes, destOffset_, srcOffset_, props);
+      return;
+    }
+
     modeMemory->copyFrom(src.modeMemory, bytes, destOffset_, srcOffset_, props);
   }
 
@@ -263,6 +276,12 @@ namespace occa {
                << " trying to access [" << offset_ << ", " << (offset_ + bytes) << "]",
                udim_t(bytes + offset_) <= modeMemory->size);
 
+    modeGraph_t *capturingGraph = modeMemory->getModeDevice()->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopyToHost(dest, modeMemory, bytes, offset_, props);
+      return;
+    }
+
     modeMemory->copyTo(dest, bytes, offset_, props);
   }
 
@@ -296,6 +315,12 @@ namespace occa {
                << " trying to access [" << destOffset_ << ", " << (destOffset_ + bytes) << "]",
                udim_t(bytes + destOffset_) <= dest.modeMemory->size);
 
+    modeGraph_t *capturingGraph = dest.modeMemory->getModeDevice()->capturingGraph;
+    if (capturingGraph) {
+      capturingGraph->addCopy(dest.modeMemory, modeMemory, bytes, destOffset_, srcOffset_, props);
+      return;
+    }
+
     dest.modeMemory->copyFrom(modeMemory, bytes, destOffset_, srcOffset_, props);
   }
 
@@ -113,7 +113,7 @@ namespace occa {
     if (modeMemoryPool == NULL) {
       return 0;
     }
-    return modeMemoryPool->reserved;
+    return modeMemoryPool->reservedBytes();
   }
 
   udim_t memoryPool::numReservations() const {
@@ -147,6 +147,18 @@ namespace occa {
     resize(reserved());
   }
 
+  void memoryPool::compact() {
+    assertInitialized();
+    modeMemoryPool->compact();
+  }
+
+  occa::json memoryPool::threadCacheStats() const {
+    if (modeMemoryPool == NULL) {
+      return occa::json();
+    }
+    return modeMemoryPool->threadCacheStats();
+  }
+
   void memoryPool::free() {
     if (modeMemoryPool == NULL) return;
     delete modeMemoryPool;
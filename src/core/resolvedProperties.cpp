@@ -0,0 +1,63 @@
+#include <occa/core/resolvedProperties.hpp>
+
+namespace occa {
+  resolvedProperties::resolvedProperties(modeDevice_t *modeDevice_,
+                                         const type_t type_,
+                                         occa::json &&props_,
+                                         const hash_t &kernelHash_) {
+    std::shared_ptr<data_t> data_ = std::make_shared<data_t>();
+    data_->modeDevice = modeDevice_;
+    data_->type = type_;
+    data_->props = std::move(props_);
+    data_->hash = occa::hash(data_->props);
+    data_->kernelHash = kernelHash_;
+    data = data_;
+  }
+
+  bool resolvedProperties::isInitialized() const {
+    return (bool) data;
+  }
+
+  resolvedProperties::type_t resolvedProperties::type() const {
+    return data ? data->type : none_;
+  }
+
+  const occa::json& resolvedProperties::properties() const {
+    static const occa::json noProperties;
+    return data ? data->props : noProperties;
+  }
+
+  const hash_t& resolvedProperties::hash() const {
+    static const hash_t noHash;
+    return data ? data->hash : noHash;
+  }
+
+  bool resolvedProperties::operator == (const resolvedProperties &other) const {
+    if (data == other.data) {
+      return true;
+    }
+    if (!data || !other.data) {
+      return false;
+    }
+    return (
+      (data->modeDevice == other.data->modeDevice)
+      && (data->type == other.data->type)
+      && (data->hash == other.data->hash)
+    );
+  }
+
+  bool resolvedProperties::operator != (const resolvedProperties &other) const {
+    return !(*this == other);
+  }
+
+  void resolvedProperties::assertResolvedFor(modeDevice_t *modeDevice_,
+                                             const type_t type_) const {
+    OCCA_ERROR("Properties have not been resolved",
+               (bool) data);
+    OCCA_ERROR("Properties were resolved for a different device",
+               data->modeDevice == modeDevice_);
+    OCCA_ERROR("Properties were resolved for a different call, use the matching"
+               " device.resolve*Properties method",
+               data->type == type_);
+  }
+}
@@ -138,6 +138,84 @@ module occa_kernel_m
     ! void occaKernelVaRun(occaKernel kernel, const int argc, va_list args);
     ! NOTE: There is no clean way to implement this in Fortran as there is no
     !       clean way to map va_list (https://en.wikipedia.org/wiki/Stdarg.h)
+
+    ! void occaKernelRunWithArgs(occaKernel kernel,
+    !                            const int argc,
+    !                            occaType *args);
+    subroutine occaKernelRunWithArgs(kernel, argc, args) &
+               bind(C, name="occaKernelRunWithArgs")
+      import occaKernel, C_int, occaType
+      implicit none
+      type(occaKernel), value :: kernel
+      integer(C_int), value, intent(in) :: argc
+      type(occaType), dimension(*), intent(in) :: args
+    end subroutine
+
+    ! ---[ Bound Kernel ]-------------------
+    ! NOTE: Argument indices start at 0, as in C
+
+    ! occaBoundKernel occaCreateBoundKernel(occaKernel kernel);
+    type(occaBoundKernel) function occaCreateBoundKernel(kernel) &
+                                   bind(C, name="occaCreateBoundKernel")
+      import occaKernel, occaBoundKernel
+      implicit none
+      type(occaKernel), value :: kernel
+    end function
+
+    ! int occaBoundKernelArgumentIndex(occaBoundKernel boundKernel,
+    !                                  const char *name);
+    integer(C_int) function occaBoundKernelArgumentIndex(boundKernel, name) &
+                            bind(C, name="occaBoundKernelArgumentIndex")
+      import occaBoundKernel, C_int, C_char
+      implicit none
+      type(occaBoundKernel), value :: boundKernel
+      character(len=1,kind=C_char), dimension(*), intent(in) :: name
+    end function
+
+    ! void occaBoundKernelBindArg(occaBoundKernel boundKernel,
+    !                             const int index,
+    !                             occaType arg);
+    subroutine occaBoundKernelBindArg(boundKernel, index, arg) &
+               bind(C, name="occaBoundKernelBindArg")
+      import occaBoundKernel, C_int, occaType
+      implicit none
+      type(occaBoundKernel), value :: boundKernel
+      integer(C_int), value, intent(in) :: index
+      type(occaType), value :: arg
+    end subroutine
+
+    ! void occaBoundKernelBindNamedArg(occaBoundKernel boundKernel,
+    !                                  const char *name,
+    !                                  occaType arg);
+    subroutine occaBoundKernelBindNamedArg(boundKernel, name, arg) &
+               bind(C, name="occaBoundKernelBindNamedArg")
+      import occaBoundKernel, C_char, occaType
+      implicit none
+      type(occaBoundKernel), value :: boundKernel
+      character(len=1,kind=C_char), dimension(*), intent(in) :: name
+      type(occaType), value :: arg
+    end subroutine
+
+    ! void occaBoundKernelBindArgs(occaBoundKernel boundKernel,
+    !                              const int argc,
+    !                              occaType *args);
+    subroutine occaBoundKernelBindArgs(boundKernel, argc, args) &
+               bind(C, name="occaBoundKernelBindArgs")
+      import occaBoundKernel, C_int, occaType
+      implicit none
+      type(occaBoundKernel), value :: boundKernel
+      integer(C_int), value, intent(in) :: argc
+      type(occaType), dimension(*), intent(in) :: args
+    end subroutine
+
+    ! void occaBoundKernelLaunch(occaBoundKernel boundKernel);
+    subroutine occaBoundKernelLaunch(boundKernel) &
+               bind(C, name="occaBoundKernelLaunch")
+      import occaBoundKernel
+      implicit none
+      type(occaBoundKernel), value :: boundKernel
+    end subroutine
+    ! ======================================
   end interface
 
   interface occaKernelRunN
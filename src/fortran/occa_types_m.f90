@@ -7,6 +7,7 @@ module occa_types_m
 
     occaDevice => occaType, &
     occaKernel => occaType, &
+    occaBoundKernel => occaType, &
     occaKernelBuilder => occaType, &
     occaMemory => occaType, &
     occaStream => occaType, &
@@ -212,6 +213,8 @@ module occa_types_m
   integer(C_int), bind(C, name="OCCA_DTYPE")         :: OCCA_C_DTYPE
   integer(C_int), bind(C, name="OCCA_SCOPE")         :: OCCA_C_SCOPE
   integer(C_int), bind(C, name="OCCA_JSON")          :: OCCA_C_JSON
+
+  integer(C_int), bind(C, name="OCCA_BOUNDKERNEL")   :: OCCA_C_BOUNDKERNEL
   ! ======================================
 
   ! ---[ Globals & Flags ]----------------
@@ -322,6 +322,16 @@ namespace occa {
       return oType;
     }
 
+    occaType newOccaType(const occa::boundKernel &boundKernel) {
+      occaType oType;
+      oType.magicHeader = OCCA_C_TYPE_MAGIC_HEADER;
+      oType.type  = typeType::boundKernel;
+      oType.bytes = sizeof(void*);
+      oType.value.ptr = (char*) &boundKernel;
+      oType.needsFree = true;
+      return oType;
+    }
+
     occaType newOccaType(const occa::json &json,
                          const bool needsFree) {
       if (json.isNull()) {
@@ -541,6 +551,12 @@ namespace occa {
       return *((occa::scope*) value.value.ptr);
     }
 
+    occa::boundKernel& boundKernel(occaType value) {
+      OCCA_ERROR("Input is not an occaBoundKernel",
+                 value.type == typeType::boundKernel);
+      return *((occa::boundKernel*) value.value.ptr);
+    }
+
     occa::json& json(occaType value) {
       OCCA_ERROR("Input is not an occaJson",
                  value.type == typeType::json);
@@ -651,6 +667,8 @@ const int OCCA_STREAMTAG     = occa::c::typeType::streamTag;
 const int OCCA_DTYPE         = occa::c::typeType::dtype;
 const int OCCA_SCOPE         = occa::c::typeType::scope;
 const int OCCA_JSON          = occa::c::typeType::json;
+
+const int OCCA_BOUNDKERNEL   = occa::c::typeType::boundKernel;
 //======================================
 
 //---[ Globals & Flags ]----------------
@@ -828,6 +846,10 @@ void occaFree(occaType *value) {
         delete &occa::c::json(valueRef);
       }
       break;
+    }
+    case occa::c::typeType::boundKernel: {
+      delete &occa::c::boundKernel(valueRef);
+      break;
     }}
   valueRef.magicHeader = occaUndefined.magicHeader;
 }
@@ -1045,6 +1067,21 @@ void occaPrintTypeInfo(occaType value) {
       case occa::c::typeType::json:
         info["type"]  = "json";
         info["value"] = occa::c::json(value);
+        break;
+      case occa::c::typeType::boundKernel: {
+        occa::boundKernel &boundKernel = occa::c::boundKernel(value);
+
+        info["type"]  = "boundKernel";
+        info["value"] = (void*) value.value.ptr;
+        if (boundKernel.isInitialized()) {
+          info["name"]  = boundKernel.getKernel().name();
+          info["argc"]  = boundKernel.argumentCount();
+        } else {
+          info["initialized"] = false;
+        }
+
+        break;
+      }
     }
   }
 
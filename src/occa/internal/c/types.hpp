@@ -44,6 +44,8 @@ namespace occa {
       static const int dtype         = 24;
       static const int scope         = 25;
       static const int json          = 26;
+
+      static const int boundKernel   = 27;
     }
 
     occaType defaultOccaType();
@@ -105,6 +107,7 @@ namespace occa {
     occaType newOccaType(const occa::kernelBuilder &kernelBuilder);
     occaType newOccaType(const occa::dtype_t &dtype);
     occaType newOccaType(const occa::scope &scope);
+    occaType newOccaType(const occa::boundKernel &boundKernel);
 
     occaType newOccaType(const json &json,
                          const bool needsFree);
@@ -130,6 +133,7 @@ namespace occa {
 
     occa::dtype_t& dtype(occaType value);
     occa::scope& scope(occaType value);
+    occa::boundKernel& boundKernel(occaType value);
 
     occa::json& json(occaType value);
     occa::json inferJson(occaType value);
@@ -28,7 +28,7 @@ namespace occa {
     // Remove ref from device
     if (modeDevice) {
       if (!isWrapped) {
-        modeDevice->bytesAllocated -= size;
+        modeDevice->removeBytesAllocated(size);
       }
 
       modeDevice->removeMemoryRef(this);
@@ -1,6 +1,9 @@
+#include <algorithm>
+
 #include <occa/internal/core/device.hpp>
 #include <occa/internal/core/kernel.hpp>
 #include <occa/internal/core/buffer.hpp>
+#include <occa/internal/core/graph.hpp>
 #include <occa/internal/core/memory.hpp>
 #include <occa/internal/core/stream.hpp>
 #include <occa/internal/core/streamTag.hpp>
@@ -12,10 +15,16 @@ namespace occa {
     mode((std::string) properties_["mode"]),
     properties(properties_),
     needsLauncherKernel(false),
+    capturingGraph(NULL),
     bytesAllocated(0),
-    maxBytesAllocated(0) {}
+    maxBytesAllocated(0),
+    kernelCacheHits(0),
+    kernelCacheMisses(0) {}
 
   modeDevice_t::~modeDevice_t() {
+    kernelMutex.free();
+    memoryMutex.free();
+
     // Null all wrappers
     while (deviceRing.head) {
       device *mem = (device*) deviceRing.head;
@@ -26,6 +35,9 @@ namespace occa {
 
   // Must be called before ~modeDevice_t()!
   void modeDevice_t::freeResources() {
+    delete capturingGraph;
+    capturingGraph = NULL;
+
     freeRing<modeKernel_t>(kernelRing);
     freeRing<modeBuffer_t>(memoryRing);
     freeRing<modeStream_t>(streamRing);
@@ -49,19 +61,41 @@ namespace occa {
   }
 
   void modeDevice_t::addKernelRef(modeKernel_t *kernel) {
+    // Kernels can be built concurrently through device::buildKernels
+    kernelMutex.lock();
     kernelRing.addRef(kernel);
+    kernelMutex.unlock();
   }
 
   void modeDevice_t::removeKernelRef(modeKernel_t *kernel) {
+    kernelMutex.lock();
     kernelRing.removeRef(kernel);
+    kernelMutex.unlock();
   }
 
   void modeDevice_t::addMemoryRef(modeBuffer_t *buffer) {
+    memoryMutex.lock();
     memoryRing.addRef(buffer);
+    memoryMutex.unlock();
   }
 
   void modeDevice_t::removeMemoryRef(modeBuffer_t *buffer) {
+    memoryMutex.lock();
     memoryRing.removeRef(buffer);
+    memoryMutex.unlock();
+  }
+
+  void modeDevice_t::addBytesAllocated(const udim_t bytes) {
+    memoryMutex.lock();
+    bytesAllocated += bytes;
+    maxBytesAllocated = std::max(maxBytesAllocated, bytesAllocated);
+    memoryMutex.unlock();
+  }
+
+  void modeDevice_t::removeBytesAllocated(const udim_t bytes) {
+    memoryMutex.lock();
+    bytesAllocated -= bytes;
+    memoryMutex.unlock();
   }
 
   void modeDevice_t::addStreamRef(modeStream_t *stream) {
@@ -98,6 +132,7 @@ namespace occa {
 
   hash_t modeDevice_t::versionedHash() const {
     return (occa::hash(settings()["version"])
+            ^ occa::hash(OCCA_CACHE_VERSION)
             ^ hash());
   }
 
@@ -133,19 +168,101 @@ namespace occa {
                          kernel->name);
   }
 
-  kernel& modeDevice_t::getCachedKernel(const hash_t &kernelHash,
-                                        const std::string &kernelName) {
+  kernel modeDevice_t::getCachedKernel(const hash_t &kernelHash,
+                                       const std::string &kernelName) {
+    kernel cachedKernel;
+
+    kernelMutex.lock();
+    auto it = cachedKernels.find(getKernelHash(kernelHash, kernelName));
+    if (it != cachedKernels.end()) {
+      cachedKernel = it->second;
+      ++kernelCacheHits;
+    } else {
+      ++kernelCacheMisses;
+    }
+    kernelMutex.unlock();
+
+    return cachedKernel;
+  }
+
+  kernel modeDevice_t::cacheKernel(const hash_t &kernelHash,
+                                   const std::string &kernelName,
+                                   kernel &kernel_) {
+    const std::string hash = getKernelHash(kernelHash, kernelName);
+
+    kernelMutex.lock();
+    // Another thread could have built the same kernel, keep the first one
+    modeKernel_t *&cachedKernel = cachedKernels[hash];
+    if (!cachedKernel) {
+      cachedKernel = kernel_.getModeKernel();
+      cachedKernelHashes[cachedKernel] = hash;
+    }
+    kernel ret(cachedKernel);
+    kernelMutex.unlock();
 
-    return cachedKernels[getKernelHash(kernelHash, kernelName)];
+    return ret;
+  }
+
+  kernel modeDevice_t::getCachedSourceKernel(const hash_t &sourceHash,
+                                             const std::string &kernelName) {
+    // Misses are counted by the getCachedKernel() call after hashing the source
+    kernel cachedKernel;
+
+    kernelMutex.lock();
+    auto hashIt = sourceKernelHashes.find(sourceHash);
+    if (hashIt != sourceKernelHashes.end()) {
+      auto it = cachedKernels.find(getKernelHash(hashIt->second, kernelName));
+      if (it != cachedKernels.end()) {
+        cachedKernel = it->second;
+        ++kernelCacheHits;
+      }
+    }
+    kernelMutex.unlock();
+
+    return cachedKernel;
+  }
+
+  void modeDevice_t::cacheSourceKernelHash(const hash_t &sourceHash,
+                                           const hash_t &kernelHash) {
+    kernelMutex.lock();
+    sourceKernelHashes[sourceHash] = kernelHash;
+    kernelMutex.unlock();
+  }
+
+  bool modeDevice_t::releaseKernelRef(modeKernel_t *modeKernel,
+                                      kernel *ker) {
+    // The last reference leaves the cache in the same critical section
+    //   getCachedKernel() hands out references in, so kernels being
+    //   freed are never returned
+    kernelMutex.lock();
+    modeKernel->removeKernelRef(ker);
+    const bool needsFree = modeKernel->needsFree();
+    if (needsFree) {
+      eraseCachedKernel(modeKernel);
+    }
+    kernelMutex.unlock();
+
+    return needsFree;
   }
 
   void modeDevice_t::removeCachedKernel(modeKernel_t *kernel) {
     if (kernel == NULL) {
       return;
     }
-    cachedKernelMapIterator it = cachedKernels.find(getKernelHash(kernel));
-    if (it != cachedKernels.end()) {
-      cachedKernels.erase(it);
+    kernelMutex.lock();
+    eraseCachedKernel(kernel);
+    kernelMutex.unlock();
+  }
+
+  void modeDevice_t::eraseCachedKernel(modeKernel_t *kernel) {
+    auto it = cachedKernelHashes.find(kernel);
+    if (it != cachedKernelHashes.end()) {
+      cachedKernels.erase(it->second);
+      cachedKernelHashes.erase(it);
     }
   }
+
+  bool modeDevice_t::canBuildKernelsConcurrently() const {
+    return false;
+  }
 }
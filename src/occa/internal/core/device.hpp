@@ -3,6 +3,7 @@
 
 #include <occa/core/device.hpp>
 #include <occa/types/json.hpp>
+#include <occa/utils/mutex.hpp>
 #include <occa/internal/utils/gc.hpp>
 #include <occa/internal/lang/kernelMetadata.hpp>
 
@@ -22,10 +23,23 @@ namespace occa {
 
     stream currentStream;
 
+    // Set between device::beginCapture() and device::endCapture()
+    modeGraph_t *capturingGraph;
+
+    // Buffers can be created from multiple threads, such as memory pool slabs
+    //   taken by thread caches, so memoryRing and the byte counts are locked
+    mutex_t memoryMutex;
     udim_t bytesAllocated;
     udim_t maxBytesAllocated;
 
-    cachedKernelMap cachedKernels;
+    // Cached kernels aren't referenced, they're removed when their last reference is released
+    std::map<std::string, modeKernel_t*> cachedKernels;
+    std::map<modeKernel_t*, std::string> cachedKernelHashes;
+    // Kernel hashes of built sources so cache hits don't touch the filesystem
+    std::map<hash_t, hash_t> sourceKernelHashes;
+    mutex_t kernelMutex;
+    udim_t kernelCacheHits;
+    udim_t kernelCacheMisses;
 
     modeDevice_t(const occa::json &json_);
 
@@ -51,6 +65,8 @@ namespace occa {
 
     void addMemoryRef(modeBuffer_t *buffer);
     void removeMemoryRef(modeBuffer_t *buffer);
+    void addBytesAllocated(const udim_t bytes);
+    void removeBytesAllocated(const udim_t bytes);
 
     void addStreamRef(modeStream_t *stream);
     void removeStreamRef(modeStream_t *stream);
@@ -94,11 +110,29 @@ namespace occa {
 
     std::string getKernelHash(modeKernel_t *kernel);
 
-    kernel& getCachedKernel(const hash_t &kernelHash,
-                            const std::string &kernelName);
+    kernel getCachedKernel(const hash_t &kernelHash,
+                           const std::string &kernelName);
+
+    kernel cacheKernel(const hash_t &kernelHash,
+                       const std::string &kernelName,
+                       kernel &kernel_);
+
+    kernel getCachedSourceKernel(const hash_t &sourceHash,
+                                 const std::string &kernelName);
+
+    void cacheSourceKernelHash(const hash_t &sourceHash,
+                               const hash_t &kernelHash);
+
+    bool releaseKernelRef(modeKernel_t *modeKernel,
+                          kernel *ker);
 
     void removeCachedKernel(modeKernel_t *kernel);
 
+    // Expects kernelMutex to be locked
+    void eraseCachedKernel(modeKernel_t *kernel);
+
+    virtual bool canBuildKernelsConcurrently() const;
+
     virtual modeKernel_t* buildKernel(const std::string &filename,
                                       const std::string &kernelName,
                                       const hash_t hash,
@@ -0,0 +1,353 @@
+#include <algorithm>
+
+#include <occa/internal/core/device.hpp>
+#include <occa/internal/core/graph.hpp>
+#include <occa/internal/core/kernel.hpp>
+#include <occa/internal/core/memory.hpp>
+#include <occa/internal/utils/threadPool.hpp>
+
+namespace occa {
+  namespace {
+    // Host pointers can alias each other, so they're all treated as one resource
+    const char hostResource = 0;
+  }
+
+  //---[ graphNode_t ]------------------
+  graphNode_t::graphNode_t(const stream &nodeStream_) :
+    nodeStream(nodeStream_),
+    isBarrier(false) {}
+
+  graphNode_t::~graphNode_t() {}
+
+  void graphNode_t::addAccess(const void *resource,
+                              const bool isWrite) {
+    accesses.push_back({resource, isWrite});
+  }
+
+  void graphNode_t::addMemoryAccess(modeMemory_t *modeMemory,
+                                    const bool isWrite) {
+    // Slices share their buffer, so dependencies are found per buffer
+    addAccess(modeMemory->modeBuffer, isWrite);
+  }
+
+  void graphNode_t::addHostAccess(const bool isWrite) {
+    addAccess(&hostResource, isWrite);
+  }
+
+  bool graphNode_t::dependsOn(const graphNode_t &other) const {
+    for (const access_t &access : accesses) {
+      for (const access_t &otherAccess : other.accesses) {
+        if ((access.resource == otherAccess.resource)
+            && (access.isWrite || otherAccess.isWrite)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  kernelGraphNode_t::kernelGraphNode_t(const stream &nodeStream_,
+                                       modeKernel_t *modeKernel,
+                                       const std::vector<kernelArgData> &arguments_) :
+    graphNode_t(nodeStream_),
+    kernel_(modeKernel),
+    outerDims(modeKernel->outerDims),
+    innerDims(modeKernel->innerDims),
+    arguments(arguments_) {
+
+    // Launches of a kernel that isn't reentrant share its argument list
+    if (!modeKernel->isReentrant()) {
+      addAccess(modeKernel, true);
+    }
+
+    const lang::kernelMetadata_t &metadata = modeKernel->metadata;
+    const int metaArgc = (
+      metadata.isInitialized()
+      ? (int) metadata.arguments.size()
+      : 0
+    );
+
+    const int argc = (int) arguments.size();
+    for (int i = 0; i < argc; ++i) {
+      const kernelArgData &arg = arguments[i];
+      const bool isWrite = (i >= metaArgc) || !metadata.arguments[i].isConst;
+      if (arg.modeMemory) {
+        addMemoryAccess(arg.modeMemory, isWrite);
+        memoryRefs.push_back(occa::memory(arg.modeMemory));
+      } else if (arg.isPointer() && !arg.value.isNull()) {
+        addHostAccess(isWrite);
+      }
+    }
+  }
+
+  void kernelGraphNode_t::run() {
+    modeKernel_t *modeKernel = kernel_.getModeKernel();
+    OCCA_ERROR("A kernel recorded in the graph has been freed",
+               modeKernel != NULL);
+
+    // Arguments were validated when they were recorded
+    if (modeKernel->isReentrant()) {
+      // Reentrant kernels don't read the dims, so nothing is shared
+      modeKernel->runWith(arguments);
+      return;
+    }
+
+    const dim kernelOuterDims = modeKernel->outerDims;
+    const dim kernelInnerDims = modeKernel->innerDims;
+
+    modeKernel->outerDims = outerDims;
+    modeKernel->innerDims = innerDims;
+    try {
+      modeKernel->runWith(arguments);
+    } catch (...) {
+      modeKernel->outerDims = kernelOuterDims;
+      modeKernel->innerDims = kernelInnerDims;
+      throw;
+    }
+    modeKernel->outerDims = kernelOuterDims;
+    modeKernel->innerDims = kernelInnerDims;
+  }
+
+  copyGraphNode_t::copyGraphNode_t(const stream &nodeStream_,
+                                   modeMemory_t *dest_,
+                                   modeMemory_t *src_,
+                                   void *destPtr_,
+                                   const void *srcPtr_,
+                                   const udim_t bytes_,
+                                   const udim_t destOffset_,
+                                   const udim_t srcOffset_,
+                                   const occa::json &props_) :
+    graphNode_t(nodeStream_),
+    dest(dest_),
+    src(src_),
+    destPtr(destPtr_),
+    srcPtr(srcPtr_),
+    bytes(bytes_),
+    destOffset(destOffset_),
+    srcOffset(srcOffset_),
+    props(props_) {
+    if (dest_) {
+      addMemoryAccess(dest_, true);
+    } else {
+      addHostAccess(true);
+    }
+    if (src_) {
+      addMemoryAccess(src_, false);
+    } else {
+      addHostAccess(false);
+    }
+  }
+
+  void copyGraphNode_t::run() {
+    modeMemory_t *destMemory = dest.getModeMemory();
+    modeMemory_t *srcMemory = src.getModeMemory();
+    OCCA_ERROR("A memory recorded in the graph has been freed",
+               (destMemory || destPtr) && (srcMemory || srcPtr));
+
+    if (!destMemory) {
+      srcMemory->copyTo(destPtr, bytes, srcOffset, props);
+    } else if (!srcMemory) {
+      destMemory->copyFrom(srcPtr, bytes, destOffset, props);
+    } else {
+      destMemory->copyFrom(srcMemory, bytes, destOffset, srcOffset, props);
+    }
+  }
+
+  tagGraphNode_t::tagGraphNode_t(const stream &nodeStream_,
+                                 modeGraph_t &graph__,
+                                 const int tagIndex_) :
+    graphNode_t(nodeStream_),
+    graph_(graph__),
+    tagIndex(tagIndex_) {
+    isBarrier = true;
+  }
+
+  void tagGraphNode_t::run() {
+    graph_.tags[tagIndex] = graph_.modeDevice->tagStream();
+  }
+  //====================================
+
+  //---[ modeGraph_t ]------------------
+  modeGraph_t::modeGraph_t(modeDevice_t *modeDevice_,
+                           const occa::json &properties_) :
+    modeDevice(modeDevice_),
+    properties(properties_),
+    concurrent(false),
+    pool(NULL) {}
+
+  modeGraph_t::~modeGraph_t() {
+    for (graphNode_t *node : nodes) {
+      delete node;
+    }
+    delete pool;
+  }
+
+  void modeGraph_t::addNode(graphNode_t *node) {
+    nodes.push_back(node);
+  }
+
+  void modeGraph_t::addKernel(modeKernel_t *modeKernel,
+                              const std::vector<kernelArgData> &arguments) {
+    addNode(
+      new kernelGraphNode_t(modeDevice->currentStream,
+                            modeKernel,
+                            arguments)
+    );
+  }
+
+  void modeGraph_t::addCopy(modeMemory_t *dest,
+                            modeMemory_t *src,
+                            const udim_t bytes,
+                            const udim_t destOffset,
+                            const udim_t srcOffset,
+                            const occa::json &props) {
+    addNode(
+      new copyGraphNode_t(modeDevice->currentStream,
+                          dest, src,
+                          NULL, NULL,
+                          bytes,
+                          destOffset, srcOffset,
+                          props)
+    );
+  }
+
+  void modeGraph_t::addCopyFromHost(modeMemory_t *dest,
+                                    const void *src,
+                                    const udim_t bytes,
+                                    const udim_t offset,
+                                    const occa::json &props) {
+    addNode(
+      new copyGraphNode_t(modeDevice->currentStream,
+                          dest, NULL,
+                          NULL, src,
+                          bytes,
+                          offset, 0,
+                          props)
+    );
+  }
+
+  void modeGraph_t::addCopyToHost(void *dest,
+                                  modeMemory_t *src,
+                                  const udim_t bytes,
+                                  const udim_t offset,
+                                  const occa::json &props) {
+    addNode(
+      new copyGraphNode_t(modeDevice->currentStream,
+                          NULL, src,
+                          dest, NULL,
+                          bytes,
+                          0, offset,
+                          props)
+    );
+  }
+
+  void modeGraph_t::addTag() {
+    addNode(
+      new tagGraphNode_t(modeDevice->currentStream,
+                         *this,
+                         (int) tags.size())
+    );
+    tags.push_back(streamTag());
+  }
+
+  void modeGraph_t::instantiate() {
+    device = occa::device(modeDevice);
+
+    // Nodes were recorded in a valid order, so each node only needs
+    //   to be placed after the nodes it depends on
+    const int nodeCount = (int) nodes.size();
+    std::vector<int> nodeLevels(nodeCount, 0);
+    int levelCount = 0;
+    for (int j = 0; j < nodeCount; ++j) {
+      graphNode_t &node = *(nodes[j]);
+      int level = 0;
+      for (int i = 0; i < j; ++i) {
+        graphNode_t &previousNode = *(nodes[i]);
+        if (node.isBarrier
+            || previousNode.isBarrier
+            || node.dependsOn(previousNode)) {
+          level = std::max(level, nodeLevels[i] + 1);
+        }
+      }
+      nodeLevels[j] = level;
+      levelCount = std::max(levelCount, level + 1);
+    }
+
+    levels.clear();
+    levels.resize(levelCount);
+    size_t maxLevelSize = 0;
+    for (int i = 0; i < nodeCount; ++i) {
+      std::vector<int> &level = levels[nodeLevels[i]];
+      level.push_back(i);
+      maxLevelSize = std::max(maxLevelSize, level.size());
+    }
+
+    // Switching streams between nodes would race, so only
+    //   graphs on a single stream run concurrently
+    bool singleStream = true;
+    for (int i = 1; i < nodeCount; ++i) {
+      singleStream = singleStream && (nodes[i]->nodeStream == nodes[0]->nodeStream);
+    }
+
+    // Dependencies are only found through kernel arguments and copies,
+    //   so concurrent replays are opt-in
+    const int threadCount = std::min((int) maxLevelSize,
+                                     threadPool::defaultThreadCount());
+    concurrent = (
+      properties.get("concurrent", false)
+      && singleStream
+      && (threadCount > 1)
+    );
+    if (concurrent) {
+      pool = new threadPool(threadCount);
+    }
+  }
+
+  void modeGraph_t::replay() {
+    OCCA_ERROR("The graph's device has been freed",
+               device.getModeDevice() != NULL);
+
+    if (concurrent) {
+      replayConcurrently();
+    } else {
+      replaySequentially();
+    }
+  }
+
+  void modeGraph_t::replaySequentially() {
+    const stream currentStream = modeDevice->currentStream;
+    try {
+      for (graphNode_t *node : nodes) {
+        if (!(modeDevice->currentStream == node->nodeStream)) {
+          modeDevice->currentStream = node->nodeStream;
+        }
+        node->run();
+      }
+    } catch (...) {
+      modeDevice->currentStream = currentStream;
+      throw;
+    }
+    modeDevice->currentStream = currentStream;
+  }
+
+  void modeGraph_t::replayConcurrently() {
+    const stream currentStream = modeDevice->currentStream;
+    modeDevice->currentStream = nodes[0]->nodeStream;
+    try {
+      for (const std::vector<int> &level : levels) {
+        if (level.size() == 1) {
+          nodes[level[0]]->run();
+          continue;
+        }
+        pool->run((int) level.size(), [&](const int task, const int thread) {
+          nodes[level[task]]->run();
+        });
+      }
+    } catch (...) {
+      modeDevice->currentStream = currentStream;
+      throw;
+    }
+    modeDevice->currentStream = currentStream;
+  }
+  //====================================
+}
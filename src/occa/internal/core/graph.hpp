@@ -0,0 +1,154 @@
+#ifndef OCCA_INTERNAL_CORE_GRAPH_HEADER
+#define OCCA_INTERNAL_CORE_GRAPH_HEADER
+
+#include <vector>
+
+#include <occa/core/graph.hpp>
+#include <occa/core/kernel.hpp>
+#include <occa/core/memory.hpp>
+#include <occa/core/stream.hpp>
+#include <occa/types/json.hpp>
+
+namespace occa {
+  class modeGraph_t;
+  class threadPool;
+
+  //---[ graphNode_t ]------------------
+  // An operation recorded into a graph
+  class graphNode_t {
+   public:
+    // Something the operation reads or writes, used to find dependencies
+    struct access_t {
+      const void *resource;
+      bool isWrite;
+    };
+
+    stream nodeStream;
+    std::vector<access_t> accesses;
+    // Barriers depend on everything before them and everything after depends on them
+    bool isBarrier;
+
+    graphNode_t(const stream &nodeStream_);
+    virtual ~graphNode_t();
+
+    void addAccess(const void *resource,
+                   const bool isWrite);
+    void addMemoryAccess(modeMemory_t *modeMemory,
+                         const bool isWrite);
+    void addHostAccess(const bool isWrite);
+
+    bool dependsOn(const graphNode_t &other) const;
+
+    virtual void run() = 0;
+  };
+
+  class kernelGraphNode_t : public graphNode_t {
+   public:
+    occa::kernel kernel_;
+    dim outerDims, innerDims;
+    std::vector<kernelArgData> arguments;
+    // Keeps memory arguments alive while they're recorded
+    std::vector<occa::memory> memoryRefs;
+
+    kernelGraphNode_t(const stream &nodeStream_,
+                      modeKernel_t *modeKernel,
+                      const std::vector<kernelArgData> &arguments_);
+
+    void run() override;
+  };
+
+  class copyGraphNode_t : public graphNode_t {
+   public:
+    occa::memory dest, src;
+    void *destPtr;
+    const void *srcPtr;
+    udim_t bytes;
+    udim_t destOffset, srcOffset;
+    occa::json props;
+
+    copyGraphNode_t(const stream &nodeStream_,
+                    modeMemory_t *dest_,
+                    modeMemory_t *src_,
+                    void *destPtr_,
+                    const void *srcPtr_,
+                    const udim_t bytes_,
+                    const udim_t destOffset_,
+                    const udim_t srcOffset_,
+                    const occa::json &props_);
+
+    void run() override;
+  };
+
+  class tagGraphNode_t : public graphNode_t {
+   public:
+    modeGraph_t &graph_;
+    int tagIndex;
+
+    tagGraphNode_t(const stream &nodeStream_,
+                   modeGraph_t &graph__,
+                   const int tagIndex_);
+
+    void run() override;
+  };
+  //====================================
+
+  //---[ modeGraph_t ]------------------
+  class modeGraph_t {
+   public:
+    modeDevice_t *modeDevice;
+    occa::device device;
+    occa::json properties;
+
+    std::vector<graphNode_t*> nodes;
+    // Nodes grouped by dependency depth, nodes in a level are independent
+    std::vector<std::vector<int>> levels;
+    std::vector<streamTag> tags;
+
+    bool concurrent;
+    threadPool *pool;
+
+    modeGraph_t(modeDevice_t *modeDevice_,
+                const occa::json &properties_);
+    ~modeGraph_t();
+
+    //---[ Capture ]--------------------
+    void addKernel(modeKernel_t *modeKernel,
+                   const std::vector<kernelArgData> &arguments);
+
+    void addCopy(modeMemory_t *dest,
+                 modeMemory_t *src,
+                 const udim_t bytes,
+                 const udim_t destOffset,
+                 const udim_t srcOffset,
+                 const occa::json &props);
+
+    void addCopyFromHost(modeMemory_t *dest,
+                         const void *src,
+                         const udim_t bytes,
+                         const udim_t offset,
+                         const occa::json &props);
+
+    void addCopyToHost(void *dest,
+                       modeMemory_t *src,
+                       const udim_t bytes,
+                       const udim_t offset,
+                       const occa::json &props);
+
+    void addTag();
+
+    // Finds the dependencies between nodes once capturing is done
+    void instantiate();
+    //==================================
+
+    void replay();
+
+   private:
+    void addNode(graphNode_t *node);
+
+    void replaySequentially();
+    void replayConcurrently();
+  };
+  //====================================
+}
+
+#endif
@@ -3,6 +3,27 @@
 #include <occa/internal/core/memory.hpp>
 
 namespace occa {
+  namespace {
+    inline bool matchesArgSignature(const kernelArgData &arg,
+                                    const modeKernel_t::argSignature_t &signature) {
+      if (arg.modeMemory) {
+        return signature.isMemory && arg.modeMemory->dtype_->matches(signature.dtype);
+      }
+      return !signature.isMemory && (arg.value.isNull() == signature.isNull);
+    }
+
+    inline void setArgSignature(const kernelArgData &arg,
+                                modeKernel_t::argSignature_t &signature) {
+      signature.isMemory = (bool) arg.modeMemory;
+      signature.isNull = !arg.modeMemory && arg.value.isNull();
+      signature.dtype = (
+        arg.modeMemory
+        ? *(arg.modeMemory->dtype_)
+        : dtype::none
+      );
+    }
+  }
+
   modeKernel_t::modeKernel_t(modeDevice_t *modeDevice_,
                              const std::string &name_,
                              const std::string &sourceFilename_,
@@ -10,11 +31,16 @@ namespace occa {
     modeDevice(modeDevice_),
     name(name_),
     sourceFilename(sourceFilename_),
-    properties(properties_) {
+    properties(properties_),
+    typeValidation(-1) {
     modeDevice->addKernelRef(this);
   }
 
   modeKernel_t::~modeKernel_t() {
+    // Remove the kernel from the device cache
+    if (modeDevice) {
+      modeDevice->removeCachedKernel(this);
+    }
     // NULL all wrappers
     while (kernelRing.head) {
       kernel *k = (kernel*) kernelRing.head;
@@ -43,6 +69,14 @@ namespace occa {
     return kernelRing.needsFree();
   }
 
+  bool modeKernel_t::releaseKernelRef(kernel *ker) {
+    if (modeDevice) {
+      return modeDevice->releaseKernelRef(this, ker);
+    }
+    removeKernelRef(ker);
+    return needsFree();
+  }
+
   void modeKernel_t::assertArgumentLimit() const {
     // Check argument limit
     OCCA_ERROR("(" << name << ") Kernels can have at most [" << OCCA_MAX_ARGS << "] arguments",
@@ -57,16 +91,35 @@ namespace occa {
                << argIndex << "] was not created from the same device as the kernel\n"
                << "Kernel device: " << modeDevice->mode << "\n"
                << "Argument device: " << argDevice->mode << " \n",
-               !argDevice || (argDevice->mode == modeDevice->mode));
+               !argDevice
+               || (argDevice == modeDevice)
+               || (argDevice->mode == modeDevice->mode));
   }
 
-  void modeKernel_t::setArguments(kernelArg *args,
+  void modeKernel_t::setArguments(const kernelArg * const *args,
                                   const int count) {
-    arguments.clear();
-    arguments.reserve(count);
+    // Overwrite the previous launch's slots in place to avoid
+    //   releasing and reallocating them on every launch
+    int argc = 0;
     for (int i = 0; i < count; ++i) {
-      pushArgument(args[i]);
+      const kernelArg &arg = *(args[i]);
+      const int argCount = (int) arg.size();
+      for (int j = 0; j < argCount; ++j) {
+        const kernelArgData &argj = arg[j];
+        assertArgInDevice(argj, argc);
+        if (argc < (int) arguments.size()) {
+          arguments[argc] = argj;
+        } else {
+          arguments.push_back(argj);
+        }
+        ++argc;
+      }
+    }
+    if (argc < (int) arguments.size()) {
+      arguments.resize(argc);
     }
+
+    assertArgumentLimit();
   }
 
   void modeKernel_t::pushArgument(const kernelArg &arg) {
@@ -80,15 +133,63 @@ namespace occa {
     assertArgumentLimit();
   }
 
-  void modeKernel_t::setupRun() {
+  bool modeKernel_t::hasValidatedArguments() const {
     const int argc = (int) arguments.size();
+    if (argc != (int) validatedArgSignature.size()) {
+      return false;
+    }
+    for (int i = 0; i < argc; ++i) {
+      if (!matchesArgSignature(arguments[i], validatedArgSignature[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
 
-    const bool validateTypes = (
-      metadata.isInitialized()
-      && properties.get("type_validation", true)
+  bool modeKernel_t::validatesTypes() {
+    // Properties can still be set after the kernel is created,
+    //   so the setting is read on the first launch
+    if (typeValidation < 0) {
+      typeValidation = properties.get("type_validation", true);
+    }
+
+    return (
+      typeValidation
+      && metadata.isInitialized()
     );
+  }
+
+  void modeKernel_t::assertArgType(const kernelArgData &arg,
+                                   const int argIndex) const {
+    const lang::argMetadata_t &argInfo = metadata.arguments[argIndex];
+
+    modeMemory_t *mem = arg.getModeMemory();
+    const bool isNull = arg.value.isNull();
+    const bool isPtr = mem || isNull;
+    if (isPtr != argInfo.isPtr) {
+      if (argInfo.isPtr) {
+        OCCA_FORCE_ERROR("(" << hash << ":" << name << ") Kernel expects an occa::memory for argument ["
+                         << (argIndex + 1) << "]");
+      } else {
+        OCCA_FORCE_ERROR("(" << hash << ":" << name << ") Kernel expects a non-occa::memory type for argument ["
+                         << (argIndex + 1) << "]");
+      }
+    }
+
+    if (!isPtr || isNull) {
+      return;
+    }
 
-    if (!validateTypes) {
+    OCCA_ERROR("(" << hash << ":" << name << ") Argument [" << (argIndex + 1) << "] has wrong runtime type.\n"
+               << "Expected type: " << argInfo.dtype << '\n'
+               << "Received type: " << *(mem->dtype_) << '\n',
+               mem->dtype_->canBeCastedTo(argInfo.dtype));
+  }
+
+  void modeKernel_t::setupRun() {
+    const int argc = (int) arguments.size();
+
+    if (!validatesTypes()) {
       return;
     }
 
@@ -101,32 +202,18 @@ namespace occa {
                << argc << ']',
                argc == metaArgc);
 
+    if (hasValidatedArguments()) {
+      return;
+    }
+
     // TODO: Get original arg #
     for (int i = 0; i < argc; ++i) {
-      kernelArgData &arg = arguments[i];
-      lang::argMetadata_t &argInfo = metadata.arguments[i];
-
-      modeMemory_t *mem = arg.getModeMemory();
-      const bool isNull = arg.value.isNull();
-      const bool isPtr = mem || isNull;
-      if (isPtr != argInfo.isPtr) {
-        if (argInfo.isPtr) {
-          OCCA_FORCE_ERROR("(" << hash << ":" << name << ") Kernel expects an occa::memory for argument ["
-                           << (i + 1) << "]");
-        } else {
-          OCCA_FORCE_ERROR("(" << hash << ":" << name << ") Kernel expects a non-occa::memory type for argument ["
-                           << (i + 1) << "]");
-        }
-      }
-
-      if (!isPtr || isNull) {
-        continue;
-      }
+      assertArgType(arguments[i], i);
+    }
 
-      OCCA_ERROR("(" << hash << ":" << name << ") Argument [" << (i + 1) << "] has wrong runtime type.\n"
-                 << "Expected type: " << argInfo.dtype << '\n'
-                 << "Received type: " << *(mem->dtype_) << '\n',
-                 mem->dtype_->canBeCastedTo(argInfo.dtype));
+    validatedArgSignature.resize(argc);
+    for (int i = 0; i < argc; ++i) {
+      setArgSignature(arguments[i], validatedArgSignature[i]);
     }
   }
 
@@ -135,4 +222,19 @@ namespace occa {
       outerDims.isZero() || innerDims.isZero()
     );
   }
+
+  void modeKernel_t::runWith(std::vector<kernelArgData> &args) {
+    arguments.swap(args);
+    try {
+      run();
+    } catch (...) {
+      arguments.swap(args);
+      throw;
+    }
+    arguments.swap(args);
+  }
+
+  bool modeKernel_t::isReentrant() const {
+    return false;
+  }
 }
@@ -24,6 +24,18 @@ namespace occa {
     // References
     gc::ring_t<kernel> kernelRing;
 
+    // Arguments are only type checked when their signature changes
+    //   Memory dtypes are kept by value so they're compared by identity,
+    //   not by an address that can be reused after the dtype is freed
+    struct argSignature_t {
+      bool isMemory;
+      bool isNull;
+      dtype_t dtype;
+    };
+
+    int typeValidation;
+    std::vector<argSignature_t> validatedArgSignature;
+
     modeKernel_t(modeDevice_t *modeDevice_,
                  const std::string &name_,
                  const std::string &sourceFilename_,
@@ -33,21 +45,33 @@ namespace occa {
     void addKernelRef(kernel *ker);
     void removeKernelRef(kernel *ker);
     bool needsFree() const;
+    bool releaseKernelRef(kernel *ker);
 
     void assertArgumentLimit() const;
     void assertArgInDevice(const kernelArgData &arg,
                           const int argIndex) const;
 
-    void setArguments(kernelArg *args,
+    void setArguments(const kernelArg * const *args,
                       const int count);
     void pushArgument(const kernelArg &arg);
 
     void setSourceMetadata(lang::parser_t &parser);
 
+    bool validatesTypes();
+    void assertArgType(const kernelArgData &arg,
+                       const int argIndex) const;
+
+    bool hasValidatedArguments() const;
     void setupRun();
 
     bool isNoop() const;
 
+    // Launches with [args] in place of the kernel's own argument list
+    //   The default swaps them in, so only reentrant kernels, which don't
+    //   read the kernel's arguments or dims on launch, can run concurrently
+    virtual void runWith(std::vector<kernelArgData> &args);
+    virtual bool isReentrant() const;
+
     //---[ Virtual Methods ]------------
     virtual ~modeKernel_t() = 0;
 
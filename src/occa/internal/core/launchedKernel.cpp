@@ -49,7 +49,8 @@ namespace occa {
         launcherArgs.add(arg);
       }
     }
-    launcherKernel->arguments = launcherArgs.args;
+    launcherKernel->arguments.assign(launcherArgs.args.begin(),
+                                     launcherArgs.args.end());
 
 
     int kernelCount = (int) deviceKernels.size();
@@ -1,17 +1,49 @@
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+
 #include <occa/internal/utils/sys.hpp>
 #include <occa/internal/modes/serial/device.hpp>
 #include <occa/internal/modes/serial/memory.hpp>
 #include <occa/internal/modes/serial/memoryPool.hpp>
 
 namespace occa {
+  // Ids key the thread cache maps and are never reused
+  static std::atomic<udim_t> nextPoolId(0);
+
+  // Keeps a pool from being freed while an exiting thread flushes its caches
+  static std::mutex threadCacheMapsMutex;
+
+  static const udim_t defaultThreadCacheSlabBytes = (1 << 20);
 
   modeMemoryPool_t::modeMemoryPool_t(modeDevice_t *modeDevice_,
                                      const occa::json &properties_) :
     modeBuffer_t(modeDevice_, 0, properties_),
     alignment(128),
     reserved(0),
-    buffer(nullptr) {
+    buffer(nullptr),
+    reservingBlock(false),
+    parentPool(nullptr),
+    poolId(nextPoolId++),
+    isThreadSafe(false) {
     verbose = properties_.get("verbose", false);
+
+    const std::string allocator = properties_.get<std::string>("allocator", "scan");
+    OCCA_ERROR("Unknown memoryPool allocator [" << allocator << "]",
+               (allocator == "scan") || (allocator == "best_fit"));
+    useBestFit = (allocator == "best_fit");
+
+    const std::string growth = properties_.get<std::string>("growth", "reallocate");
+    OCCA_ERROR("Unknown memoryPool growth [" << growth << "]",
+               (growth == "reallocate") || (growth == "slabs"));
+    useSlabs = (growth == "slabs");
+    slabSize = properties_.get<udim_t>("slab_size", 0);
+
+    // Thread caches are built on slabs
+    useThreadCache = properties_.get("thread_cache", false);
+    if (useThreadCache) {
+      useSlabs = true;
+    }
   }
 
   modeMemoryPool_t::~modeMemoryPool_t() {
@@ -21,6 +53,22 @@ namespace occa {
       memoryPoolRing.removeRef(memPool);
       memPool->modeMemoryPool = NULL;
     }
+    if (useThreadCache) {
+      std::lock_guard<std::mutex> mapsLock(threadCacheMapsMutex);
+      for (threadCache_t *cache : threadCaches) {
+        std::lock_guard<std::mutex> ownerLock(cache->owner->mutex);
+        cache->owner->caches.erase(poolId);
+      }
+    }
+    for (modeMemoryPool_t *slab : slabs) {
+      delete slab;
+    }
+    for (threadCache_t *cache : threadCaches) {
+      for (modeMemoryPool_t *slab : cache->slabs) {
+        delete slab;
+      }
+      delete cache;
+    }
     if (buffer) delete buffer;
     size=0;
   }
@@ -38,7 +86,15 @@ namespace occa {
   }
 
   void modeMemoryPool_t::addModeMemoryRef(modeMemory_t *mem) {
+    std::unique_lock<std::recursive_mutex> lock(reservationMutex, std::defer_lock);
+    if (isThreadSafe) lock.lock();
+
     modeMemoryRing.addRef(mem);
+    if (useBestFit) {
+      addBlockRef(mem);
+      reservations.emplace(mem);
+      return;
+    }
     /*Find how much of this mem is a new reservation*/
     dim_t lo = (mem->offset / alignment) * alignment; //Round down to alignment
     dim_t hi = ((mem->offset + mem->size + alignment - 1)
@@ -64,12 +120,20 @@ namespace occa {
   }
 
   void modeMemoryPool_t::removeModeMemoryRef(modeMemory_t *mem) {
+    std::unique_lock<std::recursive_mutex> lock(reservationMutex, std::defer_lock);
+    if (isThreadSafe) lock.lock();
+
     modeMemoryRing.removeRef(mem);
 
     /*Remove this mem from the reservation list*/
     auto pos = reservations.find(mem);
     reservations.erase(pos);
 
+    if (useBestFit) {
+      removeBlockRef(mem);
+      return;
+    }
+
     /*Find how much of this mem is removed from reserved space*/
     dim_t lo = (mem->offset / alignment) * alignment; //Round down to alignment
     dim_t hi = ((mem->offset + mem->size + alignment - 1)
@@ -96,11 +160,47 @@ namespace occa {
     return memoryPoolRing.needsFree();
   }
 
-  udim_t modeMemoryPool_t::numReservations() const {
-    return reservations.size();
+  udim_t modeMemoryPool_t::numReservations() {
+    std::unique_lock<std::recursive_mutex> lock(reservationMutex, std::defer_lock);
+    if (isThreadSafe) lock.lock();
+
+    udim_t count = reservations.size();
+    forEachSlabList([&](std::vector<modeMemoryPool_t*> &slabList) {
+      for (modeMemoryPool_t *slab : slabList) {
+        count += slab->numReservations();
+      }
+    });
+    return count;
+  }
+
+  udim_t modeMemoryPool_t::reservedBytes() {
+    if (!useThreadCache) {
+      return reserved;
+    }
+
+    /*Slabs don't report to a thread cached pool to avoid sharing a counter*/
+    udim_t count = 0;
+    forEachSlabList([&](std::vector<modeMemoryPool_t*> &slabList) {
+      for (modeMemoryPool_t *slab : slabList) {
+        count += slab->reservedBytes();
+      }
+    });
+    return count;
   }
 
   modeMemory_t* modeMemoryPool_t::reserve(const udim_t bytes) {
+    std::unique_lock<std::recursive_mutex> lock(reservationMutex, std::defer_lock);
+    if (isThreadSafe) lock.lock();
+
+    if (useThreadCache) {
+      return reserveFromThreadCache(bytes);
+    }
+    if (useSlabs) {
+      return reserveFromSlabs(bytes);
+    }
+    if (useBestFit) {
+      return reserveBestFit(bytes);
+    }
 
     const udim_t alignedBytes = ((bytes + alignment - 1) / alignment) * alignment;
 
@@ -136,12 +236,28 @@ namespace occa {
 
   void modeMemoryPool_t::resize(const udim_t bytes) {
 
+    const udim_t reserved_ = reservedBytes();
     OCCA_ERROR("Cannot resize memoryPool below current usage"
-               "(reserved: " << reserved << ", bytes: " << bytes << ")",
-               reserved <= bytes);
+               "(reserved: " << reserved_ << ", bytes: " << bytes << ")",
+               reserved_ <= bytes);
 
     if (size == bytes) return; /*Nothing to do*/
 
+    if (useSlabs) {
+      if (bytes > size) {
+        std::unique_lock<std::mutex> poolLock(poolMutex, std::defer_lock);
+        if (useThreadCache) poolLock.lock();
+        addSlab(bytes - size);
+      } else {
+        releaseEmptySlabs(bytes);
+      }
+      return;
+    }
+
+    reallocate(bytes);
+  }
+
+  void modeMemoryPool_t::reallocate(const udim_t bytes) {
     const udim_t alignedBytes = ((bytes + alignment - 1) / alignment) * alignment;
 
     if (verbose) {
@@ -159,10 +275,7 @@ namespace occa {
       buffer->malloc(alignedBytes);
       size = alignedBytes;
 
-      modeDevice->bytesAllocated += alignedBytes;
-      modeDevice->maxBytesAllocated = std::max(
-        modeDevice->maxBytesAllocated, modeDevice->bytesAllocated
-      );
+      modeDevice->addBytesAllocated(alignedBytes);
 
     } else {
       /*
@@ -173,10 +286,7 @@ namespace occa {
       modeBuffer_t* newBuffer = makeBuffer();
       newBuffer->malloc(alignedBytes);
 
-      modeDevice->bytesAllocated += alignedBytes;
-      modeDevice->maxBytesAllocated = std::max(
-        modeDevice->maxBytesAllocated, modeDevice->bytesAllocated
-      );
+      modeDevice->addBytesAllocated(alignedBytes);
 
       /*Loop through the reservation list*/
       auto it = reservations.begin();
@@ -231,6 +341,10 @@ namespace occa {
       size = alignedBytes;
       reserved = newReserved;
     }
+
+    if (useBestFit) {
+      rebuildBlocks();
+    }
   }
 
   void modeMemoryPool_t::setAlignment(const udim_t newAlignment) {
@@ -240,6 +354,17 @@ namespace occa {
 
     if (alignment == newAlignment) return; /*Nothing to do*/
 
+    if (useSlabs) {
+      forEachSlabList([&](std::vector<modeMemoryPool_t*> &slabList) {
+        for (modeMemoryPool_t *slab : slabList) {
+          slab->setAlignment(newAlignment);
+        }
+      });
+      updateSlabTotals();
+      alignment = newAlignment;
+      return;
+    }
+
     if (reservations.size() != 0) {
       /*
       There are currently reservations.
@@ -284,10 +409,7 @@ namespace occa {
       modeBuffer_t* newBuffer = makeBuffer();
       newBuffer->malloc(newReserved);
 
-      modeDevice->bytesAllocated += newReserved;
-      modeDevice->maxBytesAllocated = std::max(
-        modeDevice->maxBytesAllocated, modeDevice->bytesAllocated
-      );
+      modeDevice->addBytesAllocated(newReserved);
 
       /*Loop through the reservation list and migrate to new alignment*/
       it = reservations.begin();
@@ -341,5 +463,356 @@ namespace occa {
     }
 
     alignment = newAlignment;
+
+    if (useBestFit) {
+      rebuildBlocks();
+    }
+  }
+
+  modeMemory_t* modeMemoryPool_t::reserveBestFit(const udim_t bytes) {
+    const udim_t alignedBytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+    dim_t offset = 0;
+    if (alignedBytes && !freeSpace.reserve(alignedBytes, offset)) {
+      /*
+      No free range fits the request.
+      Grow the pool, which packs the reservations and leaves the free space at the end
+      */
+      reallocate(reserved + alignedBytes);
+      freeSpace.reserve(alignedBytes, offset);
+    }
+
+    reservingBlock = true;
+    modeMemory_t *mem = slice(offset, bytes);
+    reservingBlock = false;
+
+    return mem;
+  }
+
+  void modeMemoryPool_t::addBlockRef(modeMemory_t *mem) {
+    if (mem->size == 0) return;
+
+    if (reservingBlock) {
+      /*New block from reserveBestFit, offset is already aligned*/
+      block_t block;
+      block.size = ((mem->size + alignment - 1) / alignment) * alignment;
+      block.refs = 1;
+      blocks[mem->offset] = block;
+      memoryBlocks[mem] = mem->offset;
+      reserved += block.size;
+      if (parentPool && !parentPool->useThreadCache) parentPool->reserved += block.size;
+      return;
+    }
+
+    /*Slices share the block they were cut from*/
+    blockMap::iterator it = blocks.upper_bound(mem->offset);
+    OCCA_ERROR("Memory slice is outside of the memoryPool reservations",
+               it != blocks.begin());
+    --it;
+    OCCA_ERROR("Memory slice is outside of the memoryPool reservations",
+               (udim_t) (mem->offset + mem->size) <= (udim_t) it->first + it->second.size);
+
+    ++(it->second.refs);
+    memoryBlocks[mem] = it->first;
+  }
+
+  void modeMemoryPool_t::removeBlockRef(modeMemory_t *mem) {
+    memoryBlockMap::iterator it = memoryBlocks.find(mem);
+    if (it == memoryBlocks.end()) return;
+
+    blockMap::iterator block = blocks.find(it->second);
+    memoryBlocks.erase(it);
+
+    if (--(block->second.refs) == 0) {
+      reserved -= block->second.size;
+      if (parentPool && !parentPool->useThreadCache) parentPool->reserved -= block->second.size;
+      freeSpace.release(block->first, block->second.size);
+      blocks.erase(block);
+    }
+  }
+
+  void modeMemoryPool_t::rebuildBlocks() {
+    /*
+    Offsets changed after packing the buffer.
+    Group overlapping reservations into blocks and free the gaps between them
+    */
+    blocks.clear();
+    memoryBlocks.clear();
+    freeSpace.clear();
+    reserved = 0;
+
+    dim_t freeStart = 0;
+    dim_t blockLo = 0;
+    dim_t blockHi = 0;
+    bool hasBlock = false;
+
+    auto closeBlock = [&]() {
+      blocks[blockLo].size = blockHi - blockLo;
+      reserved += blockHi - blockLo;
+      freeSpace.release(freeStart, blockLo - freeStart);
+      freeStart = blockHi;
+    };
+
+    for (modeMemory_t* m : reservations) {
+      if (m->size == 0) continue;
+
+      const dim_t mlo = (m->offset / alignment) * alignment;
+      const dim_t mhi = ((m->offset + m->size + alignment - 1)
+                         / alignment) * alignment;
+
+      if (hasBlock && mlo < blockHi) {
+        blockHi = std::max(blockHi, mhi);
+        ++(blocks[blockLo].refs);
+      } else {
+        if (hasBlock) closeBlock();
+        blockLo = mlo;
+        blockHi = mhi;
+        blocks[blockLo].refs = 1;
+        hasBlock = true;
+      }
+      memoryBlocks[m] = blockLo;
+    }
+    if (hasBlock) closeBlock();
+
+    if ((udim_t) freeStart < size) {
+      freeSpace.release(freeStart, size - freeStart);
+    }
+  }
+
+  void modeMemoryPool_t::compact() {
+    if (!useSlabs) {
+      resize(reserved);
+      return;
+    }
+
+    /*Pack each slab on its own to avoid holding a copy of the whole pool*/
+    forEachSlabList([&](std::vector<modeMemoryPool_t*> &slabList) {
+      std::vector<modeMemoryPool_t*> liveSlabs;
+      for (modeMemoryPool_t *slab : slabList) {
+        if (slab->reservations.size() == 0) {
+          delete slab;
+        } else {
+          slab->resize(slab->reserved);
+          liveSlabs.push_back(slab);
+        }
+      }
+      slabList.swap(liveSlabs);
+    });
+
+    updateSlabTotals();
+  }
+
+  modeMemory_t* modeMemoryPool_t::reserveFromSlabs(const udim_t bytes) {
+    const udim_t alignedBytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+    for (modeMemoryPool_t *slab : slabs) {
+      if (slab->freeSpace.largestRange() >= alignedBytes) {
+        return slab->reserve(bytes);
+      }
+    }
+
+    addSlab(std::max(alignedBytes, slabSize ? slabSize : size));
+    return slabs.back()->reserve(bytes);
+  }
+
+  void modeMemoryPool_t::addSlab(const udim_t bytes) {
+    const udim_t alignedBytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+    if (verbose) {
+      io::stdout << "MemoryPool: Adding a slab of " << alignedBytes << " bytes\n";
+    }
+
+    occa::json slabProps = properties;
+    slabProps["allocator"] = "best_fit";
+    slabProps["growth"] = "reallocate";
+    slabProps["thread_cache"] = false;
+
+    modeMemoryPool_t *slab = modeDevice->createMemoryPool(slabProps);
+    slab->dontUseRefs();
+    slab->parentPool = this;
+    slab->isThreadSafe = useThreadCache;
+    slab->setAlignment(alignment);
+    slab->resize(alignedBytes);
+
+    slabs.push_back(slab);
+    size += slab->size;
+  }
+
+  void modeMemoryPool_t::releaseEmptySlabs(const udim_t bytes) {
+    forEachSlabList([&](std::vector<modeMemoryPool_t*> &slabList) {
+      std::vector<modeMemoryPool_t*> keptSlabs;
+      for (modeMemoryPool_t *slab : slabList) {
+        if ((slab->numReservations() == 0)
+            && (size - slab->size >= bytes)) {
+          size -= slab->size;
+          delete slab;
+        } else {
+          keptSlabs.push_back(slab);
+        }
+      }
+      slabList.swap(keptSlabs);
+    });
+  }
+
+  void modeMemoryPool_t::updateSlabTotals() {
+    size = 0;
+    reserved = 0;
+    forEachSlabList([&](std::vector<modeMemoryPool_t*> &slabList) {
+      for (modeMemoryPool_t *slab : slabList) {
+        size += slab->size;
+        reserved += slab->reserved;
+      }
+    });
+  }
+
+  //---[ Thread Cache ]-----------------
+  template <class func_t>
+  void modeMemoryPool_t::forEachSlabList(func_t func) {
+    if (!useThreadCache) {
+      func(slabs);
+      return;
+    }
+
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+    func(slabs);
+    for (threadCache_t *cache : threadCaches) {
+      std::lock_guard<std::mutex> cacheLock(cache->mutex);
+      func(cache->slabs);
+    }
+  }
+
+  occa::json modeMemoryPool_t::threadCacheStats() {
+    occa::json stats;
+    stats.asArray();
+    if (!useThreadCache) {
+      return stats;
+    }
+
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+    for (threadCache_t *cache : threadCaches) {
+      std::lock_guard<std::mutex> cacheLock(cache->mutex);
+
+      udim_t slabBytes = 0;
+      for (modeMemoryPool_t *slab : cache->slabs) {
+        slabBytes += slab->size;
+      }
+
+      occa::json cacheStats;
+      cacheStats["hits"] = cache->hits;
+      cacheStats["misses"] = cache->misses;
+      cacheStats["slabs"] = (udim_t) cache->slabs.size();
+      cacheStats["bytes"] = slabBytes;
+      stats += cacheStats;
+    }
+    return stats;
+  }
+
+  modeMemory_t* modeMemoryPool_t::reserveFromThreadCache(const udim_t bytes) {
+    const udim_t alignedBytes = ((bytes + alignment - 1) / alignment) * alignment;
+
+    threadCache_t &cache = getThreadCache();
+    std::unique_lock<std::mutex> cacheLock(cache.mutex);
+
+    /*Fast path: one of this thread's slabs fits the request*/
+    for (modeMemoryPool_t *slab : cache.slabs) {
+      std::lock_guard<std::recursive_mutex> slabLock(slab->reservationMutex);
+      if (slab->freeSpace.largestRange() >= alignedBytes) {
+        ++cache.hits;
+        return slab->reserve(bytes);
+      }
+    }
+    ++cache.misses;
+
+    /*
+    Slow path: take a slab from the shared pool
+    The pool lock is taken before cache locks so release ours first
+    */
+    cacheLock.unlock();
+    modeMemoryPool_t *slab = takeSlab(alignedBytes);
+
+    cacheLock.lock();
+    cache.slabs.push_back(slab);
+    return slab->reserve(bytes);
+  }
+
+  modeMemoryPool_t::threadCacheMap_t::~threadCacheMap_t() {
+    std::lock_guard<std::mutex> mapsLock(threadCacheMapsMutex);
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &it : caches) {
+      threadCache_t *cache = it.second;
+      cache->pool->flushThreadCache(cache);
+    }
+    caches.clear();
+  }
+
+  modeMemoryPool_t::threadCache_t& modeMemoryPool_t::getThreadCache() {
+    thread_local threadCacheMap_t cacheMap;
+
+    std::lock_guard<std::mutex> mapLock(cacheMap.mutex);
+    threadCache_t *&cache = cacheMap.caches[poolId];
+    if (!cache) {
+      cache = new threadCache_t();
+      cache->hits = 0;
+      cache->misses = 0;
+      cache->pool = this;
+      cache->owner = &cacheMap;
+
+      std::lock_guard<std::mutex> poolLock(poolMutex);
+      threadCaches.push_back(cache);
+    }
+    return *cache;
+  }
+
+  void modeMemoryPool_t::flushThreadCache(threadCache_t *cache) {
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+    {
+      /*Slabs still holding reservations are reused once they're freed*/
+      std::lock_guard<std::mutex> cacheLock(cache->mutex);
+      slabs.insert(slabs.end(), cache->slabs.begin(), cache->slabs.end());
+    }
+    threadCaches.erase(
+      std::find(threadCaches.begin(), threadCaches.end(), cache)
+    );
+    delete cache;
+  }
+
+  modeMemoryPool_t* modeMemoryPool_t::takeSlab(const udim_t bytes) {
+    std::lock_guard<std::mutex> poolLock(poolMutex);
+
+    /*Reuse an unowned slab, either from resize() or flushed by an exited thread*/
+    for (int i = 0; i < (int) slabs.size(); ++i) {
+      modeMemoryPool_t *slab = slabs[i];
+      std::lock_guard<std::recursive_mutex> slabLock(slab->reservationMutex);
+      if (slab->freeSpace.largestRange() >= bytes) {
+        slabs.erase(slabs.begin() + i);
+        return slab;
+      }
+    }
+
+    /*Take an empty slab from another thread*/
+    for (threadCache_t *cache : threadCaches) {
+      std::unique_lock<std::mutex> cacheLock(cache->mutex, std::try_to_lock);
+      if (!cacheLock.owns_lock()) {
+        continue;
+      }
+      std::vector<modeMemoryPool_t*> &cacheSlabs = cache->slabs;
+      for (int i = 0; i < (int) cacheSlabs.size(); ++i) {
+        modeMemoryPool_t *slab = cacheSlabs[i];
+        if ((slab->size >= bytes) && (slab->numReservations() == 0)) {
+          cacheSlabs.erase(cacheSlabs.begin() + i);
+          return slab;
+        }
+      }
+    }
+
+    const udim_t newSlabBytes = std::max(
+      bytes,
+      slabSize ? slabSize : defaultThreadCacheSlabBytes
+    );
+    addSlab(newSlabBytes);
+
+    modeMemoryPool_t *slab = slabs.back();
+    slabs.pop_back();
+    return slab;
   }
 }
@@ -1,9 +1,15 @@
 #ifndef OCCA_INTERNAL_CORE_MEMORYPOOL_HEADER
 #define OCCA_INTERNAL_CORE_MEMORYPOOL_HEADER
 
+#include <map>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #include <occa/core/memoryPool.hpp>
 #include <occa/internal/core/buffer.hpp>
-#include <set>
+#include <occa/internal/utils/freeList.hpp>
 
 namespace occa {
 
@@ -18,6 +24,14 @@ namespace occa {
     };
     typedef std::set<modeMemory_t*, compare> reservationSet;
 
+    // Aligned range handed out by reserve(), shared by its slices
+    struct block_t {
+      udim_t size;
+      int refs;
+    };
+    typedef std::map<dim_t, block_t> blockMap;
+    typedef std::unordered_map<modeMemory_t*, dim_t> memoryBlockMap;
+
     gc::ring_t<memoryPool> memoryPoolRing;
 
     reservationSet reservations;
@@ -29,11 +43,62 @@ namespace occa {
 
     bool verbose;
 
+    // "allocator": "best_fit"
+    //   Tracks free space in a freeList instead of scanning reservations
+    bool useBestFit;
+    freeList freeSpace;
+    blockMap blocks;
+    memoryBlockMap memoryBlocks;
+    bool reservingBlock;
+
+    // "growth": "slabs"
+    //   Reservations live in slabs (best_fit pools owned by this pool)
+    //   and the pool grows by adding slabs instead of moving reservations
+    bool useSlabs;
+    udim_t slabSize;
+    std::vector<modeMemoryPool_t*> slabs;
+    modeMemoryPool_t *parentPool;
+
+    // "thread_cache": true
+    //   Each thread reserves from its own slabs without taking the pool lock.
+    //   Slabs are locked on their own since memory can be freed from any thread.
+    struct threadCacheMap_t;
+
+    struct threadCache_t {
+      std::mutex mutex;
+      std::vector<modeMemoryPool_t*> slabs;
+      udim_t hits;
+      udim_t misses;
+      modeMemoryPool_t *pool;
+      threadCacheMap_t *owner;
+    };
+
+    // A thread's caches by pool id
+    //   Entries are removed when their pool is freed and the caches are
+    //   flushed back to their pools when the thread exits
+    struct threadCacheMap_t {
+      std::mutex mutex;
+      std::unordered_map<udim_t, threadCache_t*> caches;
+
+      ~threadCacheMap_t();
+    };
+
+    bool useThreadCache;
+    udim_t poolId;
+    std::mutex poolMutex;
+    std::vector<threadCache_t*> threadCaches;
+
+    bool isThreadSafe;
+    std::recursive_mutex reservationMutex;
+
     modeMemoryPool_t(modeDevice_t *modeDevice_,
                      const occa::json &json_);
     virtual ~modeMemoryPool_t();
 
-    udim_t numReservations() const;
+    udim_t numReservations();
+    udim_t reservedBytes();
+
+    occa::json threadCacheStats();
 
     modeMemory_t* reserve(const udim_t bytes);
 
@@ -41,6 +106,8 @@ namespace occa {
 
     void setAlignment(const udim_t newAlignment);
 
+    void compact();
+
     void dontUseRefs();
     bool needsFree() const override;
     void addMemoryPoolRef(memoryPool *memPool);
@@ -49,6 +116,26 @@ namespace occa {
     void removeModeMemoryRef(modeMemory_t *mem) override;
 
    private:
+    void reallocate(const udim_t bytes);
+
+    modeMemory_t* reserveBestFit(const udim_t bytes);
+    void addBlockRef(modeMemory_t *mem);
+    void removeBlockRef(modeMemory_t *mem);
+    void rebuildBlocks();
+
+    modeMemory_t* reserveFromSlabs(const udim_t bytes);
+    void addSlab(const udim_t bytes);
+    void releaseEmptySlabs(const udim_t bytes);
+    void updateSlabTotals();
+
+    template <class func_t>
+    void forEachSlabList(func_t func);
+
+    modeMemory_t* reserveFromThreadCache(const udim_t bytes);
+    threadCache_t& getThreadCache();
+    void flushThreadCache(threadCache_t *cache);
+    modeMemoryPool_t* takeSlab(const udim_t bytes);
+
     virtual modeBuffer_t* makeBuffer()=0;
     virtual void setPtr(modeMemory_t* mem, modeBuffer_t* buf, const dim_t offset)=0;
     virtual void memcpy(modeBuffer_t* dst, const dim_t dstOffset,
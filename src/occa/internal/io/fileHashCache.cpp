@@ -0,0 +1,265 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/stat.h>
+
+#include <occa/defines.hpp>
+#include <occa/internal/io/fileHashCache.hpp>
+#include <occa/internal/io/utils.hpp>
+#include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/hash.hpp>
+#include <occa/internal/utils/string.hpp>
+#include <occa/types/json.hpp>
+
+namespace occa {
+  namespace io {
+    static const udim_t nanosecondsPerSecond = 1000000000;
+
+    static const std::string fileHashesFile = "file_hashes.json";
+
+    fileFingerprint_t::fileFingerprint_t() :
+      device(0),
+      inode(0),
+      mtime(0),
+      size(0) {}
+
+    bool fileFingerprint_t::operator == (const fileFingerprint_t &other) const {
+      return (
+        (device == other.device)
+        && (inode == other.inode)
+        && (mtime == other.mtime)
+        && (size == other.size)
+      );
+    }
+
+    bool fileFingerprint_t::operator != (const fileFingerprint_t &other) const {
+      return !(*this == other);
+    }
+
+    bool getFileFingerprint(const std::string &expFilename,
+                            fileFingerprint_t &fingerprint) {
+      struct stat statInfo;
+      if ((stat(expFilename.c_str(), &statInfo) != 0)
+          || ((statInfo.st_mode & S_IFMT) != S_IFREG)) {
+        return false;
+      }
+
+      fingerprint.device = (udim_t) statInfo.st_dev;
+      fingerprint.inode  = (udim_t) statInfo.st_ino;
+      fingerprint.size   = (udim_t) statInfo.st_size;
+
+      // mtime in nanoseconds
+#if (OCCA_OS == OCCA_LINUX_OS)
+      fingerprint.mtime = (
+        ((udim_t) statInfo.st_mtim.tv_sec * nanosecondsPerSecond)
+        + (udim_t) statInfo.st_mtim.tv_nsec
+      );
+#elif (OCCA_OS == OCCA_MACOS_OS)
+      fingerprint.mtime = (
+        ((udim_t) statInfo.st_mtimespec.tv_sec * nanosecondsPerSecond)
+        + (udim_t) statInfo.st_mtimespec.tv_nsec
+      );
+#else
+      fingerprint.mtime = (udim_t) statInfo.st_mtime * nanosecondsPerSecond;
+#endif
+
+      return true;
+    }
+
+    static std::string fingerprintToString(const fileFingerprint_t &fingerprint) {
+      return (
+        toString(fingerprint.device) + ':'
+        + toString(fingerprint.inode) + ':'
+        + toString(fingerprint.mtime) + ':'
+        + toString(fingerprint.size)
+      );
+    }
+
+    static bool fingerprintFromString(const std::string &str,
+                                      fileFingerprint_t &fingerprint) {
+      const strVector parts = split(str, ':');
+      if (parts.size() != 4) {
+        return false;
+      }
+      fingerprint.device = fromString<udim_t>(parts[0]);
+      fingerprint.inode  = fromString<udim_t>(parts[1]);
+      fingerprint.mtime  = fromString<udim_t>(parts[2]);
+      fingerprint.size   = fromString<udim_t>(parts[3]);
+      return true;
+    }
+
+    static hash_t hashFileContents(const std::string &expFilename) {
+      FILE *fp = fopen(expFilename.c_str(), "rb");
+      OCCA_ERROR("Failed to open [" << io::shortname(expFilename) << "]",
+                 fp != NULL);
+
+      // Stream the file rather than reading it into memory
+      hasher_t hasher;
+      char buffer[64 * 1024];
+      size_t bytesRead;
+      while ((bytesRead = fread(buffer, sizeof(char), sizeof(buffer), fp)) > 0) {
+        hasher.update(buffer, bytesRead);
+      }
+      fclose(fp);
+
+      return hasher.digest();
+    }
+
+    bool wasRecentlyModified(const fileFingerprint_t &fingerprint) {
+      const udim_t now = (udim_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+      ).count();
+
+      return (fingerprint.mtime + nanosecondsPerSecond) > now;
+    }
+
+    fileHashCache_t::fileHashCache_t() :
+      hits(0),
+      misses(0),
+      persistent(false),
+      modified(false) {
+      setPersistent(
+        env::get<bool>("OCCA_PERSIST_FILE_HASHES", false)
+      );
+    }
+
+    fileHashCache_t::~fileHashCache_t() {}
+
+    fileHashCache_t& fileHashCache_t::getInstance() {
+      // Never destroyed so the exit handler can still save it
+      static fileHashCache_t *cache = new fileHashCache_t();
+      return *cache;
+    }
+
+    static void saveFileHashCacheAtExit() {
+      // Exceptions can't leave the exit handler and a lost cache is harmless
+      try {
+        fileHashCache_t::getInstance().save();
+      } catch (...) {}
+    }
+
+    hash_t fileHashCache_t::hashFile(const std::string &expFilename) {
+      fileFingerprint_t fingerprint;
+      if (!getFileFingerprint(expFilename, fingerprint)) {
+        // Let the read report the error
+        return hashFileContents(expFilename);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        entryMap::iterator it = entries.find(expFilename);
+        if ((it != entries.end())
+            && (it->second.fingerprint == fingerprint)) {
+          ++hits;
+          return it->second.hash;
+        }
+        ++misses;
+      }
+
+      // Hash outside the lock so files can be read concurrently
+      const hash_t fileHash = hashFileContents(expFilename);
+
+      if (!wasRecentlyModified(fingerprint)) {
+        std::lock_guard<std::mutex> lock(mutex);
+        entry_t &entry = entries[expFilename];
+        entry.fingerprint = fingerprint;
+        entry.hash = fileHash;
+        modified = true;
+      }
+
+      return fileHash;
+    }
+
+    udim_t fileHashCache_t::cacheHits() {
+      std::lock_guard<std::mutex> lock(mutex);
+      return hits;
+    }
+
+    udim_t fileHashCache_t::cacheMisses() {
+      std::lock_guard<std::mutex> lock(mutex);
+      return misses;
+    }
+
+    void fileHashCache_t::clear() {
+      std::lock_guard<std::mutex> lock(mutex);
+      entries.clear();
+      hits = 0;
+      misses = 0;
+      modified = false;
+    }
+
+    void fileHashCache_t::setPersistent(const bool persistent_) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (persistent == persistent_) {
+        return;
+      }
+      persistent = persistent_;
+      if (persistent) {
+        persistFilename = env::OCCA_CACHE_DIR + fileHashesFile;
+        load();
+
+        // Registered after the env and io setup so it runs before they're torn down
+        static bool registeredExitHandler = false;
+        if (!registeredExitHandler) {
+          std::atexit(saveFileHashCacheAtExit);
+          registeredExitHandler = true;
+        }
+      }
+    }
+
+    void fileHashCache_t::load() {
+      if (!io::isFile(persistFilename)) {
+        return;
+      }
+
+      json fileHashes = json::read(persistFilename);
+      if (!fileHashes.isObject()
+          || (fileHashes.get<std::string>("version") != toString(OCCA_CACHE_VERSION))) {
+        return;
+      }
+
+      jsonObject files = fileHashes["files"].object();
+      for (auto &it : files) {
+        entry_t entry;
+        if (!it.second.isObject()
+            || !fingerprintFromString(it.second.get<std::string>("fingerprint"),
+                                      entry.fingerprint)) {
+          continue;
+        }
+        entry.hash = hash_t::fromString(it.second.get<std::string>("hash"));
+
+        // Entries hashed in this process are newer
+        entries.insert(entryMap::value_type(it.first, entry));
+      }
+    }
+
+    void fileHashCache_t::save() {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!persistent || !modified) {
+        return;
+      }
+
+      json fileHashes;
+      fileHashes["version"] = toString(OCCA_CACHE_VERSION);
+
+      json &files = fileHashes["files"].asObject();
+      for (auto &it : entries) {
+        json file;
+        file["fingerprint"] = fingerprintToString(it.second.fingerprint);
+        file["hash"] = it.second.hash.getFullString();
+        // Paths contain '/' so avoid operator []
+        files.set(it.first, file);
+      }
+
+      io::stageFile(
+        persistFilename,
+        false,
+        [&](const std::string &tempFilename) -> bool {
+          fileHashes.write(tempFilename);
+          return true;
+        }
+      );
+      modified = false;
+    }
+  }
+}
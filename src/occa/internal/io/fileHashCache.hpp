@@ -0,0 +1,79 @@
+#ifndef OCCA_INTERNAL_IO_FILEHASHCACHE_HEADER
+#define OCCA_INTERNAL_IO_FILEHASHCACHE_HEADER
+
+#include <map>
+#include <mutex>
+
+#include <occa/types.hpp>
+#include <occa/utils/hash.hpp>
+
+namespace occa {
+  namespace io {
+    // Identifies a file's contents without reading it
+    struct fileFingerprint_t {
+      udim_t device;
+      udim_t inode;
+      udim_t mtime;
+      udim_t size;
+
+      fileFingerprint_t();
+
+      bool operator == (const fileFingerprint_t &other) const;
+      bool operator != (const fileFingerprint_t &other) const;
+    };
+
+    bool getFileFingerprint(const std::string &expFilename,
+                            fileFingerprint_t &fingerprint);
+
+    // Files modified in the last second could still be edited without
+    //   changing their fingerprint on filesystems with coarse timestamps
+    bool wasRecentlyModified(const fileFingerprint_t &fingerprint);
+
+    // Process-wide cache of file hashes keyed by path and fingerprint
+    //   Files are only re-read when their fingerprint changes.
+    //   Files modified in the last second are not cached since their mtime
+    //   could still match a later edit on filesystems with coarse timestamps.
+    //   Setting OCCA_PERSIST_FILE_HASHES=1 stores the fingerprints in the
+    //   cache directory so later processes can skip the reads too.
+    //   They're saved by save() or by an exit handler, not a static destructor.
+    class fileHashCache_t {
+    private:
+      struct entry_t {
+        fileFingerprint_t fingerprint;
+        hash_t hash;
+      };
+      typedef std::map<std::string, entry_t> entryMap;
+
+      std::mutex mutex;
+      entryMap entries;
+      udim_t hits;
+      udim_t misses;
+
+      bool persistent;
+      bool modified;
+      std::string persistFilename;
+
+      fileHashCache_t();
+
+    public:
+      ~fileHashCache_t();
+
+      static fileHashCache_t& getInstance();
+
+      hash_t hashFile(const std::string &expFilename);
+
+      udim_t cacheHits();
+      udim_t cacheMisses();
+
+      void clear();
+
+      void setPersistent(const bool persistent_);
+      void save();
+
+    private:
+      void load();
+    };
+  }
+}
+
+#endif
@@ -33,12 +33,19 @@ namespace occa {
     const std::string launcherSourceFile = "launcher_source.cpp";
     const std::string buildFile          = "build.json";
     const std::string launcherBuildFile  = "launcher_build.json";
+    const std::string objectSourceFile   = "object_source.cpp";
+    const std::string precompiledHeader  = "precompiled_header.hpp";
+    const std::string precompiledHeaderDependencies = "precompiled_header.d";
+    const std::string jitObject          = "jit_object.o";
+    const std::string launcherJitObject  = "launcher_jit_object.o";
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
     const std::string binaryFile         = "binary";
     const std::string launcherBinaryFile = "launcher_binary";
+    const std::string objectFile         = "object.o";
 #else
     const std::string binaryFile         = "binary.dll";
     const std::string launcherBinaryFile = "launcher_binary.dll";
+    const std::string objectFile         = "object.obj";
 #endif
 
     std::string cachedRawSourceFilename(std::string filename, bool compilingCpp) {
@@ -15,6 +15,12 @@ namespace occa {
     extern const std::string launcherSourceFile;
     extern const std::string launcherBinaryFile;
     extern const std::string launcherBuildFile;
+    extern const std::string objectSourceFile;
+    extern const std::string objectFile;
+    extern const std::string jitObject;
+    extern const std::string launcherJitObject;
+    extern const std::string precompiledHeader;
+    extern const std::string precompiledHeaderDependencies;
 
     std::string cachedRawSourceFilename(std::string filename, bool compilingCpp=true);
     std::string cachedSourceFilename(std::string filename);
@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <occa/internal/lang/arena.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace arena {
+      namespace {
+        static const size_t sizeClasses = maxObjectBytes / alignment;
+
+        std::atomic<size_t> chunkBytesReserved(0);
+
+        struct freeBlock_t {
+          freeBlock_t *next;
+        };
+
+        // Free blocks and chunk space left behind by exited threads
+        //   Worker threads come and go (e.g. one pool per buildKernels call),
+        //   so their blocks are handed back instead of being lost
+        struct sharedPool_t {
+          std::mutex mutex;
+          freeBlock_t *freeBlocks[sizeClasses];
+          // Checked without locking so allocations don't lock while it's empty
+          std::atomic<bool> hasFreeBlocks[sizeClasses];
+          std::vector<std::pair<char*, char*>> chunks;
+
+          sharedPool_t() {
+            for (size_t i = 0; i < sizeClasses; ++i) {
+              freeBlocks[i] = NULL;
+              hasFreeBlocks[i] = false;
+            }
+          }
+        };
+
+        // Never destroyed since thread pools can exit after static destructors ran
+        inline sharedPool_t& getSharedPool() {
+          static sharedPool_t *pool = new sharedPool_t();
+          return *pool;
+        }
+
+        struct threadPool_t {
+          freeBlock_t *freeBlocks[sizeClasses];
+          char *chunkStart;
+          char *chunkEnd;
+
+          // Signed since blocks can be released by a thread that didn't allocate them
+          long long liveBytes;
+          long long peakBytes;
+          size_t allocations;
+
+          threadPool_t() :
+            chunkStart(NULL),
+            chunkEnd(NULL),
+            liveBytes(0),
+            peakBytes(0),
+            allocations(0) {
+            for (size_t i = 0; i < sizeClasses; ++i) {
+              freeBlocks[i] = NULL;
+            }
+          }
+
+          ~threadPool_t() {
+            sharedPool_t &sharedPool = getSharedPool();
+            std::lock_guard<std::mutex> guard(sharedPool.mutex);
+
+            for (size_t i = 0; i < sizeClasses; ++i) {
+              freeBlock_t *head = freeBlocks[i];
+              if (!head) {
+                continue;
+              }
+              freeBlock_t *tail = head;
+              while (tail->next) {
+                tail = tail->next;
+              }
+              tail->next = sharedPool.freeBlocks[i];
+              sharedPool.freeBlocks[i] = head;
+              sharedPool.hasFreeBlocks[i] = true;
+            }
+
+            if ((size_t) (chunkEnd - chunkStart) >= alignment) {
+              sharedPool.chunks.push_back({chunkStart, chunkEnd});
+            }
+          }
+
+          // Take freed blocks of this size class from exited threads
+          freeBlock_t* takeSharedBlocks(const size_t sizeClass) {
+            sharedPool_t &sharedPool = getSharedPool();
+            if (!sharedPool.hasFreeBlocks[sizeClass - 1].load(std::memory_order_relaxed)) {
+              return NULL;
+            }
+            std::lock_guard<std::mutex> guard(sharedPool.mutex);
+
+            freeBlock_t *blocks = sharedPool.freeBlocks[sizeClass - 1];
+            sharedPool.freeBlocks[sizeClass - 1] = NULL;
+            sharedPool.hasFreeBlocks[sizeClass - 1] = false;
+            return blocks;
+          }
+
+          inline void addBlock(const size_t blockBytes) {
+            liveBytes += blockBytes;
+            peakBytes = std::max(peakBytes, liveBytes);
+            ++allocations;
+          }
+
+          void newChunk() {
+            {
+              sharedPool_t &sharedPool = getSharedPool();
+              std::lock_guard<std::mutex> guard(sharedPool.mutex);
+              if (sharedPool.chunks.size()) {
+                chunkStart = sharedPool.chunks.back().first;
+                chunkEnd = sharedPool.chunks.back().second;
+                sharedPool.chunks.pop_back();
+                return;
+              }
+            }
+            chunkStart = (char*) ::operator new(chunkBytes);
+            chunkEnd = chunkStart + chunkBytes;
+            chunkBytesReserved += chunkBytes;
+          }
+        };
+
+        inline threadPool_t& getThreadPool() {
+          static thread_local threadPool_t pool;
+          return pool;
+        }
+
+        inline size_t getSizeClass(const size_t bytes) {
+          return (bytes + alignment - 1) / alignment;
+        }
+      }
+
+      void* allocate(const size_t bytes) {
+        const size_t sizeClass = getSizeClass(bytes);
+        if (!sizeClass || (sizeClass > sizeClasses)) {
+          return ::operator new(bytes);
+        }
+
+        threadPool_t &pool = getThreadPool();
+        const size_t blockBytes = sizeClass * alignment;
+        pool.addBlock(blockBytes);
+
+        freeBlock_t *&freeBlock = pool.freeBlocks[sizeClass - 1];
+        if (freeBlock) {
+          void *ptr = freeBlock;
+          freeBlock = freeBlock->next;
+          return ptr;
+        }
+
+        freeBlock = pool.takeSharedBlocks(sizeClass);
+        if (freeBlock) {
+          void *ptr = freeBlock;
+          freeBlock = freeBlock->next;
+          return ptr;
+        }
+
+        while ((size_t) (pool.chunkEnd - pool.chunkStart) < blockBytes) {
+          // The rest of the old chunk is dropped, it's at most maxObjectBytes
+          pool.newChunk();
+        }
+
+        void *ptr = pool.chunkStart;
+        pool.chunkStart += blockBytes;
+        return ptr;
+      }
+
+      void release(void *ptr, const size_t bytes) {
+        if (!ptr) {
+          return;
+        }
+
+        const size_t sizeClass = getSizeClass(bytes);
+        if (!sizeClass || (sizeClass > sizeClasses)) {
+          ::operator delete(ptr);
+          return;
+        }
+
+        // Blocks can be freed from another thread since chunks are never released
+        //   and they go back to the shared pool when that thread exits
+        threadPool_t &pool = getThreadPool();
+        pool.liveBytes -= sizeClass * alignment;
+
+        freeBlock_t *&freeBlock = pool.freeBlocks[sizeClass - 1];
+        freeBlock_t *block = (freeBlock_t*) ptr;
+        block->next = freeBlock;
+        freeBlock = block;
+      }
+
+      size_t reservedBytes() {
+        return chunkBytesReserved;
+      }
+
+      threadStats_t threadStats() {
+        const threadPool_t &pool = getThreadPool();
+
+        threadStats_t stats;
+        stats.liveBytes = (size_t) std::max(0LL, pool.liveBytes);
+        stats.peakBytes = (size_t) std::max(0LL, pool.peakBytes);
+        stats.allocations = pool.allocations;
+        return stats;
+      }
+
+      void resetThreadPeak() {
+        threadPool_t &pool = getThreadPool();
+        pool.peakBytes = pool.liveBytes;
+      }
+    }
+  }
+}
@@ -0,0 +1,73 @@
+#ifndef OCCA_INTERNAL_LANG_ARENA_HEADER
+#define OCCA_INTERNAL_LANG_ARENA_HEADER
+
+#include <cstddef>
+#include <new>
+
+namespace occa {
+  namespace lang {
+    // Allocator for the small objects created while translating
+    //   (tokens, expression nodes, statements and token list nodes)
+    //
+    //   Objects are carved out of large chunks and recycled through
+    //   per-thread free lists sorted by size, so parsing doesn't go
+    //   through malloc/free for every token and node.
+    //   Chunks stay alive for the whole process and are reused by later
+    //   translations, since tokens and nodes can outlive their parser.
+    namespace arena {
+      static const size_t alignment = alignof(std::max_align_t);
+      static const size_t maxObjectBytes = 256;
+      static const size_t chunkBytes = 64 * 1024;
+
+      void* allocate(const size_t bytes);
+      void release(void *ptr, const size_t bytes);
+
+      // Bytes reserved in chunks across all threads
+      size_t reservedBytes();
+
+      // Blocks handed out by the calling thread
+      //   Blocks released on another thread count against that thread instead
+      struct threadStats_t {
+        size_t liveBytes;
+        size_t peakBytes;
+        size_t allocations;
+      };
+
+      threadStats_t threadStats();
+
+      // Restarts the calling thread's peak from its live bytes
+      void resetThreadPeak();
+    }
+
+    template <class TM>
+    class arenaAllocator {
+     public:
+      typedef TM value_type;
+
+      inline arenaAllocator() {}
+
+      template <class TM2>
+      inline arenaAllocator(const arenaAllocator<TM2> &) {}
+
+      inline TM* allocate(const size_t count) {
+        return (TM*) arena::allocate(count * sizeof(TM));
+      }
+
+      inline void deallocate(TM *ptr, const size_t count) {
+        arena::release(ptr, count * sizeof(TM));
+      }
+
+      template <class TM2>
+      inline bool operator == (const arenaAllocator<TM2> &) const {
+        return true;
+      }
+
+      template <class TM2>
+      inline bool operator != (const arenaAllocator<TM2> &) const {
+        return false;
+      }
+    };
+  }
+}
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <occa/internal/io/output.hpp>
 #include <occa/types/primitive.hpp>
+#include <occa/internal/lang/arena.hpp>
 #include <occa/internal/lang/printer.hpp>
 #include <occa/internal/lang/token.hpp>
 #include <occa/internal/lang/expr/exprNodeArray.hpp>
@@ -87,6 +88,15 @@ namespace occa {
 
       virtual ~exprNode();
 
+      // Nodes are allocated from the translation arena
+      inline void* operator new(const size_t bytes) {
+        return arena::allocate(bytes);
+      }
+
+      inline void operator delete(void *ptr, const size_t bytes) {
+        arena::release(ptr, bytes);
+      }
+
       template <class TM>
       inline bool is() const {
         return (dynamic_cast<const TM*>(this) != NULL);
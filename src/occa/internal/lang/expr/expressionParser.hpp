@@ -10,10 +10,10 @@ namespace occa {
   namespace lang {
     class expressionScopedState;
 
-    typedef std::list<exprNode*>             exprNodeList;
-    typedef std::list<token_t*>              tokenList;
-    typedef std::list<exprOpNode*>           operatorList;
-    typedef std::list<expressionScopedState> scopedStateList;
+    typedef std::list<exprNode*, arenaAllocator<exprNode*>>     exprNodeList;
+    typedef std::list<token_t*, arenaAllocator<token_t*>>       tokenList;
+    typedef std::list<exprOpNode*, arenaAllocator<exprOpNode*>> operatorList;
+    typedef std::list<expressionScopedState>                    scopedStateList;
 
     //---[ Expression Scoped State ]----
     class expressionScopedState {
@@ -4,6 +4,7 @@
 #include <occa/internal/utils/string.hpp>
 
 #include <occa/internal/lang/file.hpp>
+#include <occa/internal/lang/token.hpp>
 #include <occa/internal/lang/tokenizer.hpp>
 
 namespace occa {
@@ -27,6 +28,13 @@ namespace occa {
       dontUseRefs();
     }
 
+    file_t::~file_t() {
+      const int tokenCount = (int) cachedTokens.size();
+      for (int i = 0; i < tokenCount; ++i) {
+        delete cachedTokens[i].token;
+      }
+    }
+
     namespace originSource {
       file_t builtin(true, "(builtin)");
       file_t string(true, "(source)" );
@@ -2,6 +2,7 @@
 #define OCCA_INTERNAL_LANG_FILE_HEADER
 
 #include <iostream>
+#include <vector>
 
 #include <occa/internal/io/output.hpp>
 #include <occa/internal/utils/gc.hpp>
@@ -9,27 +10,6 @@
 
 namespace occa {
   namespace lang {
-    class file_t : public gc::withRefs {
-    public:
-      std::string filename;
-      std::string expandedFilename;
-      std::string content;
-
-      file_t(const std::string &filename_);
-
-      file_t(const std::string &filename_,
-             const std::string &content_);
-
-      // Used for originSource
-      file_t(const bool,
-             const std::string &name);
-    };
-
-    namespace originSource {
-      extern file_t builtin;
-      extern file_t string;
-    }
-
     class filePosition {
     public:
       int line;
@@ -53,6 +33,41 @@ namespace occa {
       std::string str() const;
     };
 
+    class token_t;
+
+    // Token lexed ahead of time and where the tokenizer ends up after it
+    struct cachedToken_t {
+      token_t *token;
+      filePosition end;
+    };
+
+    class file_t : public gc::withRefs {
+    public:
+      std::string filename;
+      std::string expandedFilename;
+      std::string content;
+
+      // Set by the fileCache_t for files shared across translations
+      std::vector<cachedToken_t> cachedTokens;
+      std::string includeGuard;
+
+      file_t(const std::string &filename_);
+
+      file_t(const std::string &filename_,
+             const std::string &content_);
+
+      // Used for originSource
+      file_t(const bool,
+             const std::string &name);
+
+      ~file_t();
+    };
+
+    namespace originSource {
+      extern file_t builtin;
+      extern file_t string;
+    }
+
     class fileOrigin : public gc::withRefs {
     public:
       bool fromInclude;
@@ -0,0 +1,229 @@
+#include <occa/internal/io.hpp>
+#include <occa/internal/lang/fileCache.hpp>
+#include <occa/internal/lang/token.hpp>
+#include <occa/internal/lang/tokenizer.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace {
+      // Indices of the first token in each non-empty line
+      std::vector<size_t> getLineStarts(const std::vector<cachedToken_t> &cachedTokens) {
+        std::vector<size_t> lineStarts;
+        bool isNewLine = true;
+
+        const size_t tokenCount = cachedTokens.size();
+        for (size_t i = 0; i < tokenCount; ++i) {
+          if (cachedTokens[i].token->type() & tokenType::newline) {
+            isNewLine = true;
+          } else if (isNewLine) {
+            lineStarts.push_back(i);
+            isNewLine = false;
+          }
+        }
+        return lineStarts;
+      }
+
+      // Returns the token after index if it's an identifier on the same line
+      identifierToken* getIdentifierAfter(const std::vector<cachedToken_t> &cachedTokens,
+                                          const size_t index) {
+        if ((index + 1) >= cachedTokens.size()) {
+          return NULL;
+        }
+        token_t *token = cachedTokens[index + 1].token;
+        if (!(token->type() & tokenType::identifier)) {
+          return NULL;
+        }
+        return &(token->to<identifierToken>());
+      }
+
+      // Returns the directive name if the line starting at index is a directive
+      std::string getDirective(const std::vector<cachedToken_t> &cachedTokens,
+                               const size_t index) {
+        if (!(cachedTokens[index].token->getOpType() & operatorType::hash)) {
+          return "";
+        }
+        identifierToken *directive = getIdentifierAfter(cachedTokens, index);
+        return directive ? directive->value : "";
+      }
+    }
+
+    fileCache_t::fileCache_t() :
+      hits(0),
+      misses(0) {}
+
+    fileCache_t::~fileCache_t() {
+      // Files aren't freed since tokens in other static objects
+      //   could still reference them while exiting
+    }
+
+    fileCache_t& fileCache_t::getInstance() {
+      static fileCache_t cache;
+      return cache;
+    }
+
+    file_t* fileCache_t::load(const std::string &filename) {
+      const std::string expFilename = io::expandFilename(filename);
+
+      io::fileFingerprint_t fingerprint;
+      if (!io::getFileFingerprint(expFilename, fingerprint)
+          || io::wasRecentlyModified(fingerprint)) {
+        // Let the read report missing files
+        return new file_t(filename);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        entryMap::iterator it = entries.find(expFilename);
+        if ((it != entries.end())
+            && (it->second.fingerprint == fingerprint)) {
+          ++hits;
+          return it->second.file;
+        }
+        ++misses;
+      }
+
+      // Read and tokenize outside the lock so files can be loaded concurrently
+      file_t *file = new file_t(filename);
+      if (!tokenizeFile(*file)) {
+        return file;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      entry_t &entry = entries[expFilename];
+      if (entry.file) {
+        if (entry.fingerprint == fingerprint) {
+          // Another thread loaded the same file first
+          delete file;
+          return entry.file;
+        }
+        staleFiles.push_back(entry.file);
+      }
+      entry.fingerprint = fingerprint;
+      entry.file = file;
+
+      return file;
+    }
+
+    udim_t fileCache_t::cacheHits() {
+      std::lock_guard<std::mutex> lock(mutex);
+      return hits;
+    }
+
+    udim_t fileCache_t::cacheMisses() {
+      std::lock_guard<std::mutex> lock(mutex);
+      return misses;
+    }
+
+    void fileCache_t::clear() {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto &it : entries) {
+        delete it.second.file;
+      }
+      for (file_t *file : staleFiles) {
+        delete file;
+      }
+      entries.clear();
+      staleFiles.clear();
+      hits = 0;
+      misses = 0;
+    }
+
+    bool fileCache_t::tokenizeFile(file_t &file) {
+      std::vector<cachedToken_t> cachedTokens;
+
+      // The tokenizer and cached tokens shouldn't free the file
+      file.dontUseRefs();
+
+      bool isShareable;
+      {
+        // Errors are reported when the file is actually used
+        tokenizer_t tokenizer(&file);
+        tokenizer.printErrors = false;
+
+        while (!tokenizer.reachedTheEnd() && !tokenizer.errors) {
+          token_t *token = tokenizer.getToken();
+          if (!token) {
+            continue;
+          }
+          // Comment spacing depends on the previous token so they're always lexed,
+          //   and the last newline is added by the tokenizer when the source ends
+          if ((token->type() & tokenType::comment)
+              || (*(token->origin.position.start) == '\0')) {
+            delete token;
+            continue;
+          }
+          cachedToken_t cached;
+          cached.token = token;
+          cached.end = tokenizer.fp;
+          cachedTokens.push_back(cached);
+        }
+        isShareable = !tokenizer.errors;
+      }
+
+      if (isShareable) {
+        // #line renames the file for everyone sharing it
+        const std::vector<size_t> lineStarts = getLineStarts(cachedTokens);
+        for (size_t lineStart : lineStarts) {
+          if (getDirective(cachedTokens, lineStart) == "line") {
+            isShareable = false;
+            break;
+          }
+        }
+      }
+
+      if (!isShareable) {
+        for (cachedToken_t &cached : cachedTokens) {
+          delete cached.token;
+        }
+        file.setRefs(0);
+        return false;
+      }
+
+      file.cachedTokens.swap(cachedTokens);
+      file.includeGuard = findIncludeGuard(file.cachedTokens);
+      return true;
+    }
+
+    std::string fileCache_t::findIncludeGuard(const std::vector<cachedToken_t> &cachedTokens) {
+      // Look for:
+      //   #ifndef GUARD
+      //   #define GUARD
+      //   ...
+      //   #endif
+      // where the #endif closes the #ifndef and nothing else is outside of it
+      const std::vector<size_t> lineStarts = getLineStarts(cachedTokens);
+      const size_t lineCount = lineStarts.size();
+      if ((lineCount < 3)
+          || (getDirective(cachedTokens, lineStarts[0]) != "ifndef")
+          || (getDirective(cachedTokens, lineStarts[1]) != "define")) {
+        return "";
+      }
+
+      identifierToken *guard = getIdentifierAfter(cachedTokens, lineStarts[0] + 1);
+      identifierToken *define = getIdentifierAfter(cachedTokens, lineStarts[1] + 1);
+      if (!guard || !define || (guard->value != define->value)) {
+        return "";
+      }
+
+      int depth = 0;
+      for (size_t i = 0; i < lineCount; ++i) {
+        const std::string directive = getDirective(cachedTokens, lineStarts[i]);
+        if ((directive == "if")
+            || (directive == "ifdef")
+            || (directive == "ifndef")) {
+          ++depth;
+        } else if (directive == "endif") {
+          --depth;
+        } else if (((directive == "elif") || (directive == "else"))
+                   && (depth == 1)) {
+          return "";
+        }
+        if ((depth <= 0) && (i < (lineCount - 1))) {
+          return "";
+        }
+      }
+
+      return depth ? "" : guard->value;
+    }
+  }
+}
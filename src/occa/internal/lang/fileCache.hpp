@@ -0,0 +1,56 @@
+#ifndef OCCA_INTERNAL_LANG_FILECACHE_HEADER
+#define OCCA_INTERNAL_LANG_FILECACHE_HEADER
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <occa/internal/io/fileHashCache.hpp>
+#include <occa/internal/lang/file.hpp>
+
+namespace occa {
+  namespace lang {
+    // Process-wide cache of source files keyed by path and fingerprint
+    //   Cached files are read and tokenized once, then shared by every
+    //   translation (refs are disabled so they're owned by the cache).
+    //   Tokenizers replay their cachedTokens instead of lexing them again.
+    //   Files modified in the last second or using #line are not shared.
+    class fileCache_t {
+    private:
+      struct entry_t {
+        io::fileFingerprint_t fingerprint;
+        file_t *file;
+      };
+      typedef std::map<std::string, entry_t> entryMap;
+
+      std::mutex mutex;
+      entryMap entries;
+      // Replaced files can still be referenced by tokens from other translations
+      std::vector<file_t*> staleFiles;
+      udim_t hits;
+      udim_t misses;
+
+      fileCache_t();
+
+    public:
+      ~fileCache_t();
+
+      static fileCache_t& getInstance();
+
+      // Returns either a shared file or a new file_t(filename)
+      file_t* load(const std::string &filename);
+
+      udim_t cacheHits();
+      udim_t cacheMisses();
+
+      // Frees all cached files, only call when no translation is running
+      void clear();
+
+    private:
+      static bool tokenizeFile(file_t &file);
+      static std::string findIncludeGuard(const std::vector<cachedToken_t> &cachedTokens);
+    };
+  }
+}
+
+#endif
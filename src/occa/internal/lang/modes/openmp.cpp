@@ -1,6 +1,7 @@
 #include <occa/internal/lang/modes/openmp.hpp>
 #include <occa/internal/lang/expr/expr.hpp>
 #include <occa/internal/lang/builtins/attributes/atomic.hpp>
+#include <occa/internal/lang/modes/oklForStatement.hpp>
 
 namespace occa {
   namespace lang {
@@ -19,6 +20,13 @@ namespace occa {
       }
 
       void openmpParser::setupOmpPragmas() {
+        strVector pragmas;
+        if (!getOmpForPragmas(pragmas)) {
+          success = false;
+          return;
+        }
+        const bool collapse = settings.get("openmp/collapse", true);
+
         statementArray outerSmnts = (
           statementArray::from(root)
           .flatFilter([&](statement_t *smnt, const statementArray &path) {
@@ -48,17 +56,80 @@ namespace occa {
             outerSmnt.printError("Unable to add [#pragma omp]");
             return;
           }
-          // Add OpenMP Pragma
-          blockStatement &outerBlock  = (blockStatement&) outerSmnt;
+          // Perfectly nested @outer loops share one iteration space
+          forStatement &outerFor = (forStatement&) outerSmnt;
+          const int collapseCount = (
+            collapse
+            ? getCollapseCount(outerFor)
+            : 1
+          );
+
+          // Add OpenMP Pragmas
           blockStatement &parentBlock = *((blockStatement*) parent);
-          pragmaStatement *pragmaSmnt = (
-            new pragmaStatement((blockStatement*) parent,
-                                pragmaToken(outerBlock.source->origin,
-                                            "omp parallel for"))
+          const int pragmaCount = (int) pragmas.size();
+          for (int p = 0; p < pragmaCount; ++p) {
+            std::string pragma = pragmas[p];
+            if ((p == (pragmaCount - 1)) && (collapseCount > 1)) {
+              pragma += " collapse(" + std::to_string(collapseCount) + ")";
+            }
+
+            pragmaStatement *pragmaSmnt = (
+              new pragmaStatement((blockStatement*) parent,
+                                  pragmaToken(outerFor.source->origin,
+                                              pragma))
+            );
+            parentBlock.addBefore(outerSmnt,
+                                  *pragmaSmnt);
+          }
+        }
+      }
+
+      bool openmpParser::getOmpForPragmas(strVector &pragmas) {
+        const std::string schedule = settings.get<std::string>("openmp/schedule", "");
+        const int chunk = settings.get("openmp/chunk", 0);
+
+        const std::string chunkStr = (
+          chunk > 0
+          ? std::to_string(chunk)
+          : ""
+        );
+
+        // Tasks are queued per thread and idle threads steal from busy ones
+        if (schedule == "work_stealing") {
+          pragmas.push_back("omp parallel");
+          pragmas.push_back("omp single");
+          pragmas.push_back(
+            chunkStr.size()
+            ? "omp taskloop grainsize(" + chunkStr + ")"
+            : "omp taskloop"
           );
-          parentBlock.addBefore(outerSmnt,
-                                *pragmaSmnt);
+          return true;
+        }
+
+        if (schedule.empty()) {
+          pragmas.push_back("omp parallel for");
+          return true;
+        }
+
+        if ((schedule != "static")
+            && (schedule != "dynamic")
+            && (schedule != "guided")
+            && (schedule != "auto")
+            && (schedule != "runtime")) {
+          occa::printError("Unknown [openmp/schedule] value [" + schedule + "], expected"
+                           " static, dynamic, guided, auto, runtime or work_stealing");
+          return false;
         }
+
+        // auto and runtime don't take a chunk size
+        if (chunkStr.size()
+            && (schedule != "auto")
+            && (schedule != "runtime")) {
+          pragmas.push_back("omp parallel for schedule(" + schedule + ", " + chunkStr + ")");
+        } else {
+          pragmas.push_back("omp parallel for schedule(" + schedule + ")");
+        }
+        return true;
       }
 
       bool openmpParser::isOuterForLoop(statement_t *smnt) {
@@ -68,6 +139,44 @@ namespace occa {
         );
       }
 
+      int openmpParser::getCollapseCount(forStatement &forSmnt) {
+        std::vector<variable_t*> iterators;
+        forStatement *smnt = &forSmnt;
+        int count = 0;
+
+        while (true) {
+          oklForStatement oklForSmnt(*smnt, "", false);
+          if (!oklForSmnt.isValid()) {
+            break;
+          }
+
+          // Bounds can't depend on the loops being collapsed with
+          bool usesIterators = false;
+          smnt->getInnerStatements()
+            .flatFilterByExprType(exprNodeType::variable)
+            .forEach([&](smntExprNode smntExpr) {
+                variable_t &var = ((variableNode*) smntExpr.node)->value;
+                for (variable_t *iterator : iterators) {
+                  usesIterators |= (&var == iterator);
+                }
+              });
+          if (usesIterators) {
+            break;
+          }
+
+          iterators.push_back(oklForSmnt.iterator);
+          ++count;
+
+          if ((smnt->children.length() != 1)
+              || !isOuterForLoop(smnt->children[0])) {
+            break;
+          }
+          smnt = (forStatement*) smnt->children[0];
+        }
+
+        return count ? count : 1;
+      }
+
       void openmpParser::setupAtomics() {
         success &= attributes::atomic::applyCodeTransformation(
           root,
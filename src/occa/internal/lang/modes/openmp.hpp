@@ -14,8 +14,12 @@ namespace occa {
 
         void setupOmpPragmas();
 
+        bool getOmpForPragmas(strVector &pragmas);
+
         bool isOuterForLoop(statement_t *smnt);
 
+        int getCollapseCount(forStatement &forSmnt);
+
         void setupAtomics();
 
         static bool transformBlockStatement(blockStatement &blockSmnt);
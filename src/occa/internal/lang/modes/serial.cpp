@@ -417,6 +417,95 @@ namespace occa {
                                  expr,
                                  indexVarNode);
       }
+
+      //---[ Kernel Sources ]-----------
+      void serialParser::splitKernelSources(strVector &kernelSources) {
+        kernelSources.clear();
+
+        statementArray kernelSmnts = root.children.getKernelStatements();
+        if (kernelSmnts.length() < 2) {
+          return;
+        }
+
+        // Every kernel source starts with everything except the kernels
+        statementArray preludeSmnts;
+        for (statement_t *smnt : root.children) {
+          if (smnt->type() & statementType::functionDecl
+              && smnt->hasAttribute("kernel")) {
+            continue;
+          }
+          if (!canDuplicateStatement(*smnt)) {
+            return;
+          }
+          preludeSmnts.push(smnt);
+        }
+
+        // Non-kernel functions are defined in each object
+        preludeSmnts
+          .filterByStatementType(statementType::function | statementType::functionDecl)
+          .forEach([&](statement_t *smnt) {
+            function_t &func = (
+              (smnt->type() & statementType::function)
+              ? ((functionStatement*) smnt)->function()
+              : ((functionDeclStatement*) smnt)->function()
+            );
+            qualifiers_t &qualifiers = func.returnType.qualifiers;
+            if (!qualifiers.has(static_)) {
+              qualifiers.addFirst(smnt->source->origin, static_);
+            }
+          });
+
+        printer pout;
+        preludeSmnts.forEach([&](statement_t *smnt) {
+          pout << *smnt;
+        });
+        const std::string prelude = pout.str();
+
+        kernelSmnts.forEach([&](statement_t *smnt) {
+          kernelSources.push_back(prelude + smnt->toString());
+        });
+      }
+
+      bool serialParser::canDuplicateStatement(statement_t &smnt) {
+        const int smntType = smnt.type();
+        if (smntType & (statementType::empty
+                        | statementType::directive
+                        | statementType::pragma
+                        | statementType::comment)) {
+          return true;
+        }
+
+        // Each object would get its own copy of mutable globals
+        if (smntType & statementType::declaration) {
+          for (auto &decl : ((declarationStatement&) smnt).declarations) {
+            vartype_t &vartype = decl.variable().vartype;
+            if (!vartype.has(const_) && !vartype.has(typedef_)) {
+              return false;
+            }
+          }
+          return true;
+        }
+
+        if (smntType & (statementType::function | statementType::functionDecl)) {
+          if (smnt.hasAttribute("kernel")) {
+            return false;
+          }
+          const function_t &func = (
+            (smntType & statementType::function)
+            ? ((functionStatement&) smnt).function()
+            : ((functionDeclStatement&) smnt).function()
+          );
+          const qualifiers_t &qualifiers = func.returnType.qualifiers;
+          return !(
+            qualifiers.has(extern_)
+            || qualifiers.has(externC)
+            || qualifiers.has(externCpp)
+          );
+        }
+
+        return false;
+      }
+      //================================
     }
   }
 }
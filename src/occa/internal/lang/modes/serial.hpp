@@ -36,6 +36,15 @@ namespace occa {
         exprNode* addExclusiveVariableArrayAccessor(statement_t &smnt,
                                                     exprNode &expr,
                                                     variable_t &var);
+
+        //---[ Kernel Sources ]---------
+        // Splits the source into one source per @kernel so they can be
+        //   compiled separately, leaving kernelSources empty if they can't
+        // Non-kernel functions are made static, so call after printing
+        void splitKernelSources(strVector &kernelSources);
+
+        static bool canDuplicateStatement(statement_t &smnt);
+        //==============================
       };
     }
   }
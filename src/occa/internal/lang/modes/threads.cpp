@@ -0,0 +1,451 @@
+#include <occa/internal/lang/modes/threads.hpp>
+#include <occa/internal/lang/modes/oklForStatement.hpp>
+#include <occa/internal/lang/builtins/attributes/atomic.hpp>
+#include <occa/internal/lang/builtins/types.hpp>
+#include <occa/internal/lang/expr.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace okl {
+      const std::string threadsParser::teamTypeName = "occaThreadTeam_t";
+      const std::string threadsParser::teamArgName = "occaThreads";
+      const std::string threadsParser::outerIndexName = "occaOuterIndex";
+
+      threadsParser::threadsParser(const occa::json &settings_) :
+        serialParser(settings_) {}
+
+      void threadsParser::afterParsing() {
+        serialParser::afterParsing();
+
+        if (!success) return;
+        setupTeamType();
+
+        if (!success) return;
+        setupThreadedKernels();
+
+        if (!success) return;
+        setupAtomics();
+      }
+
+      void threadsParser::setupTeamType() {
+        // Needs to match occa::threads::threadTeam_t
+        const std::string teamStruct = (
+          "typedef struct " + teamTypeName + " " + teamTypeName + ";\n"
+          "struct " + teamTypeName + " {\n"
+          "  int thread;\n"
+          "  int threadCount;\n"
+          "  void (*barrier)(" + teamTypeName + " *team);\n"
+          "  void (*leave)(" + teamTypeName + " *team);\n"
+          "  void (*lock)(" + teamTypeName + " *team);\n"
+          "  void (*unlock)(" + teamTypeName + " *team);\n"
+          "  void (*share)(" + teamTypeName + " *team, void **values, const int *bytes, int count);\n"
+          "  void *data;\n"
+          "};"
+        );
+
+        root.addFirst(
+          *(new sourceCodeStatement(&root, root.source, teamStruct))
+        );
+
+        identifierToken teamTypeSource(originSource::builtin,
+                                       teamTypeName);
+        root.addToScope(
+          *(new typedef_t(vartype_t(),
+                          teamTypeSource))
+        );
+      }
+
+      void threadsParser::setupThreadedKernels() {
+        root.children
+          .forEachKernelStatement([&](functionDeclStatement &kernelSmnt) {
+            setupThreadedKernel(kernelSmnt);
+          });
+      }
+
+      void threadsParser::setupThreadedKernel(functionDeclStatement &kernelSmnt) {
+        // The team is passed after the user arguments and hidden from the metadata
+        variable_t teamArg(*root.getScopeType(teamTypeName), teamArgName);
+        teamArg += pointer_t();
+
+        attribute_t &implicitArgAttr = *(getAttribute("implicitArg"));
+        attributeToken_t teamAttr(implicitArgAttr, *(teamArg.source));
+        teamArg.addAttribute(teamAttr);
+
+        kernelSmnt.function().addArgument(teamArg);
+
+        setupTeamScope(kernelSmnt, variablePtrVector());
+        setupTeamLeave(kernelSmnt);
+
+        statementArray::from(kernelSmnt)
+          .flatFilterByAttribute("outer")
+          .filterByStatementType(statementType::for_)
+          .filter([&](statement_t *smnt) {
+            return isOuterMostOuterLoop((forStatement&) *smnt);
+          })
+          .forEach([&](statement_t *smnt) {
+            if (success) {
+              splitOuterLoop((forStatement&) *smnt);
+            }
+          });
+      }
+
+      void threadsParser::setupTeamScope(blockStatement &blockSmnt,
+                                         variablePtrVector sharedVars) {
+        // Runs of statements without @outer loops are only run by the first thread
+        //   Locals are declared on every thread, initialized by the first thread
+        //   and copied to the other threads before code run by every thread
+        const int singleThreadTypes = (statementType::expression
+                                       | statementType::block
+                                       | statementType::if_
+                                       | statementType::for_
+                                       | statementType::while_
+                                       | statementType::switch_);
+        const int nestedTypes = (statementType::block
+                                 | statementType::if_
+                                 | statementType::for_
+                                 | statementType::while_);
+        const std::string team = teamArgName + "->";
+
+        statementArray newChildren;
+        statementArray singleThreadSmnts;
+        token_t *syncSource = NULL;
+
+        auto addSingleThreadSmnts = [&]() {
+          if (!singleThreadSmnts.length()) {
+            return;
+          }
+          token_t *source = singleThreadSmnts[0]->source;
+
+          blockStatement &bodySmnt = *(new blockStatement(&blockSmnt, source));
+          singleThreadSmnts.forEach([&](statement_t *smnt) {
+            smnt->up = &bodySmnt;
+            bodySmnt.children.push(smnt);
+          });
+          singleThreadSmnts.clear();
+
+          newChildren.push(
+            new sourceCodeStatement(&blockSmnt, source,
+                                    "if (" + team + "thread == 0)")
+          );
+          newChildren.push(&bodySmnt);
+          syncSource = source;
+        };
+
+        auto syncTeam = [&]() {
+          addSingleThreadSmnts();
+          if (!syncSource) {
+            return;
+          }
+          newChildren.push(
+            new sourceCodeStatement(&blockSmnt, syncSource,
+                                    getTeamSyncSource(sharedVars))
+          );
+          syncSource = NULL;
+        };
+
+        blockSmnt.children.forEach([&](statement_t *smnt) {
+          const int smntType = smnt->type();
+
+          if (hasOuterLoop(*smnt) || leavesStatement(*smnt)) {
+            syncTeam();
+            newChildren.push(smnt);
+
+            // Every thread runs @outer loops and the control flow around them
+            if ((smntType & statementType::for_) && smnt->hasAttribute("outer")) {
+              return;
+            }
+            if (smntType & nestedTypes) {
+              setupTeamScope((blockStatement&) *smnt, sharedVars);
+            }
+            if (smntType & statementType::if_) {
+              ifStatement &ifSmnt = (ifStatement&) *smnt;
+              for (elifStatement *elifSmnt : ifSmnt.elifSmnts) {
+                setupTeamScope(*elifSmnt, sharedVars);
+              }
+              if (ifSmnt.elseSmnt) {
+                setupTeamScope(*ifSmnt.elseSmnt, sharedVars);
+              }
+            }
+            return;
+          }
+
+          if (smntType & singleThreadTypes) {
+            singleThreadSmnts.push(smnt);
+            return;
+          }
+
+          if (smntType & statementType::declaration) {
+            declarationStatement &declSmnt = (declarationStatement&) *smnt;
+
+            bool canSplit = true;
+            for (variableDeclaration &decl : declSmnt.declarations) {
+              canSplit &= canSplitTeamDeclaration(decl);
+            }
+
+            if (canSplit) {
+              // Declared on every thread, the values are set by the first thread
+              addSingleThreadSmnts();
+              newChildren.push(smnt);
+              for (variableDeclaration &decl : declSmnt.declarations) {
+                variable_t &var = decl.variable();
+                if (decl.value) {
+                  singleThreadSmnts.push(
+                    new sourceCodeStatement(&blockSmnt, smnt->source,
+                                            var.name() + " = " + decl.value->toString() + ";")
+                  );
+                  delete decl.value;
+                  decl.value = NULL;
+                }
+                if (var.vartype.pointers.size()) {
+                  var.vartype.pointers.back() -= const_;
+                } else {
+                  var.vartype -= const_;
+                }
+                sharedVars.push_back(&var);
+              }
+              return;
+            }
+
+            // Every thread initializes the values before the first thread continues
+            syncTeam();
+            newChildren.push(smnt);
+            newChildren.push(
+              new sourceCodeStatement(&blockSmnt, smnt->source,
+                                      team + "barrier(" + teamArgName + ");")
+            );
+            for (variableDeclaration &decl : declSmnt.declarations) {
+              variable_t &var = decl.variable();
+              if (!var.vartype.has(const_)) {
+                sharedVars.push_back(&var);
+              }
+            }
+            return;
+          }
+
+          syncTeam();
+          newChildren.push(smnt);
+        });
+        syncTeam();
+
+        blockSmnt.children = newChildren;
+      }
+
+      bool threadsParser::canSplitTeamDeclaration(variableDeclaration &decl) {
+        // Initializers need to be assignable to the declared variable
+        const vartype_t &vartype = decl.variable().vartype;
+        return (
+          !decl.value
+          || (!vartype.isReference()
+              && !vartype.arrays.size()
+              && (vartype.type != &auto_)
+              && !vartype.has(static_)
+              && !(decl.value->type() & exprNodeType::tuple))
+        );
+      }
+
+      std::string threadsParser::getTeamSyncSource(const variablePtrVector &sharedVars) {
+        const std::string team = teamArgName + "->";
+        if (!sharedVars.size()) {
+          return team + "barrier(" + teamArgName + ");";
+        }
+
+        // Waits for the first thread and copies its locals
+        std::string values, bytes;
+        for (variable_t *var : sharedVars) {
+          if (values.size()) {
+            values += ", ";
+            bytes += ", ";
+          }
+          values += "&" + var->name();
+          bytes += "sizeof(" + var->name() + ")";
+        }
+        return (
+          "{ void *occaSharedValues[] = {" + values + "};"
+          " const int occaSharedBytes[] = {" + bytes + "};"
+          " " + team + "share(" + teamArgName + ", occaSharedValues, occaSharedBytes, "
+          + std::to_string(sharedVars.size()) + "); }"
+        );
+      }
+
+      void threadsParser::setupTeamLeave(functionDeclStatement &kernelSmnt) {
+        // Leave the team before returning so remaining barriers don't wait on this thread
+        const std::string leaveSource = teamArgName + "->leave(" + teamArgName + ");";
+
+        statementArray::from(kernelSmnt)
+          .flatFilterByStatementType(statementType::return_)
+          .forEach([&](statement_t *smnt) {
+            blockStatement &parent = *(smnt->up);
+            parent.addBefore(
+              *smnt,
+              *new sourceCodeStatement(&parent, smnt->source, leaveSource)
+            );
+          });
+
+        kernelSmnt.add(
+          *new sourceCodeStatement(&kernelSmnt, kernelSmnt.source, leaveSource)
+        );
+      }
+
+      bool threadsParser::isOuterMostOuterLoop(forStatement &forSmnt) {
+        for (auto &parentSmnt : forSmnt.getParentPath()) {
+          if ((parentSmnt->type() & statementType::for_)
+              && parentSmnt->hasAttribute("outer")) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      bool threadsParser::hasOuterLoop(statement_t &smnt) {
+        return statementArray::from(smnt)
+          .flatFilterByStatementType(statementType::for_, "outer")
+          .length();
+      }
+
+      bool threadsParser::leavesStatement(statement_t &smnt) {
+        const int jumpTypes = (statementType::return_
+                               | statementType::goto_
+                               | statementType::break_
+                               | statementType::continue_);
+        const int loopTypes = (statementType::for_
+                               | statementType::while_
+                               | statementType::switch_);
+
+        return statementArray::from(smnt)
+          .flatFilterByStatementType(jumpTypes)
+          .filter([&](statement_t *jumpSmnt) {
+            if ((jumpSmnt == &smnt)
+                || (jumpSmnt->type() & (statementType::return_ | statementType::goto_))) {
+              return true;
+            }
+            // break and continue only leave if their loop is outside of smnt
+            for (statement_t *parentSmnt = jumpSmnt->up; parentSmnt; parentSmnt = parentSmnt->up) {
+              if (parentSmnt->type() & loopTypes) {
+                return false;
+              }
+              if (parentSmnt == &smnt) {
+                break;
+              }
+            }
+            return true;
+          })
+          .length();
+      }
+
+      void threadsParser::splitOuterLoop(forStatement &forSmnt) {
+        oklForStatement oklForSmnt(forSmnt);
+        if (!oklForSmnt.isValid()) {
+          success = false;
+          return;
+        }
+
+        exprNode *iterationCount = oklForSmnt.getIterationCount();
+        const std::string countSource = iterationCount->toString();
+        delete iterationCount;
+
+        // Replace the for-loop with a block that only iterates over this thread's chunk
+        //   Chunks are contiguous and always go to the same thread, so pages
+        //   first touched by a pinned thread stay on its NUMA node
+        blockStatement &parentSmnt = *(forSmnt.up);
+        const int childIndex = forSmnt.childIndex();
+
+        blockStatement &chunkSmnt = *(new blockStatement(&parentSmnt,
+                                                         forSmnt.source));
+        parentSmnt.children[childIndex] = &chunkSmnt;
+
+        const std::string team = teamArgName + "->";
+        array<std::string> chunkSource = {
+          "const long long occaOuterCount = " + countSource + ";",
+          "const long long occaOuterBegin = (occaOuterCount * " + team + "thread) / " + team + "threadCount;",
+          "const long long occaOuterEnd = (occaOuterCount * (" + team + "thread + 1)) / " + team + "threadCount;",
+          "for (long long " + outerIndexName + " = occaOuterBegin; "
+          + outerIndexName + " < occaOuterEnd; "
+          + "++" + outerIndexName + ")"
+        };
+        chunkSource.forEach([&](std::string str) {
+          chunkSmnt.add(
+            *new sourceCodeStatement(&chunkSmnt, forSmnt.source, str)
+          );
+        });
+
+        // Loop body with the original iterator computed from the chunk index
+        identifierToken iteratorSource(oklForSmnt.iterator->source->origin,
+                                       outerIndexName);
+        identifierNode iterator(&iteratorSource,
+                                outerIndexName);
+
+        variableDeclaration decl(
+          *oklForSmnt.iterator,
+          oklForSmnt.makeDeclarationValue(iterator)
+        );
+
+        blockStatement &bodySmnt = *(new blockStatement(&chunkSmnt,
+                                                        forSmnt.source));
+        bodySmnt.swap(forSmnt);
+        chunkSmnt.add(bodySmnt);
+
+        declarationStatement &declSmnt = (
+          *(new declarationStatement(&bodySmnt,
+                                     forSmnt.source))
+        );
+        declSmnt.declarations.push_back(decl);
+        bodySmnt.addFirst(declSmnt);
+
+        // Later code can read anything written inside the loop
+        chunkSmnt.add(
+          *new sourceCodeStatement(&chunkSmnt,
+                                   forSmnt.source,
+                                   team + "barrier(" + teamArgName + ");")
+        );
+
+        delete &forSmnt;
+      }
+
+      void threadsParser::setupAtomics() {
+        success &= attributes::atomic::applyCodeTransformation(
+          root,
+          [&](blockStatement &blockSmnt) -> bool {
+            return transformAtomicStatement(blockSmnt);
+          },
+          [&](expressionStatement &exprSmnt) -> bool {
+            return transformAtomicStatement(exprSmnt);
+          }
+        );
+      }
+
+      bool threadsParser::transformAtomicStatement(statement_t &smnt) {
+        // Atomics lock the team through the kernel argument
+        if (!isInsideKernel(smnt)) {
+          smnt.printError("[@atomic] is only supported inside [@kernel] functions in [Threads] mode");
+          return false;
+        }
+
+        blockStatement &parent = *(smnt.up);
+        parent.addBefore(
+          smnt,
+          *new sourceCodeStatement(&parent,
+                                   smnt.source,
+                                   teamArgName + "->lock(" + teamArgName + ");")
+        );
+        parent.addAfter(
+          smnt,
+          *new sourceCodeStatement(&parent,
+                                   smnt.source,
+                                   teamArgName + "->unlock(" + teamArgName + ");")
+        );
+
+        return true;
+      }
+
+      bool threadsParser::isInsideKernel(statement_t &smnt) {
+        for (auto &parentSmnt : smnt.getParentPath()) {
+          if ((parentSmnt->type() & statementType::functionDecl)
+              && parentSmnt->hasAttribute("kernel")) {
+            return true;
+          }
+        }
+        return false;
+      }
+    }
+  }
+}
@@ -0,0 +1,59 @@
+#ifndef OCCA_INTERNAL_LANG_MODES_THREADS_HEADER
+#define OCCA_INTERNAL_LANG_MODES_THREADS_HEADER
+
+#include <occa/internal/lang/modes/serial.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace okl {
+      // Serial code where every thread in a team runs the kernel
+      //   Each outer-most @outer loop only iterates over the calling thread's
+      //   contiguous chunk and is followed by a team barrier.
+      //   Code outside of @outer loops runs on the first thread followed by a
+      //   team barrier, except declarations and control flow leaving the
+      //   kernel which run on every thread. Their locals are initialized by
+      //   the first thread and copied to the other threads at the barrier.
+      //   Threads leave the team when returning so barriers don't wait on them.
+      class threadsParser : public serialParser {
+       public:
+        static const std::string teamTypeName;
+        static const std::string teamArgName;
+        static const std::string outerIndexName;
+
+        threadsParser(const occa::json &settings_ = occa::json());
+
+        virtual void afterParsing();
+
+        void setupTeamType();
+
+        void setupThreadedKernels();
+        void setupThreadedKernel(functionDeclStatement &kernelSmnt);
+
+        void setupTeamScope(blockStatement &blockSmnt,
+                            variablePtrVector sharedVars);
+
+        static bool canSplitTeamDeclaration(variableDeclaration &decl);
+
+        static std::string getTeamSyncSource(const variablePtrVector &sharedVars);
+
+        void setupTeamLeave(functionDeclStatement &kernelSmnt);
+
+        bool isOuterMostOuterLoop(forStatement &forSmnt);
+
+        static bool hasOuterLoop(statement_t &smnt);
+
+        static bool leavesStatement(statement_t &smnt);
+
+        void splitOuterLoop(forStatement &forSmnt);
+
+        void setupAtomics();
+
+        bool transformAtomicStatement(statement_t &smnt);
+
+        static bool isInsideKernel(statement_t &smnt);
+      };
+    }
+  }
+}
+
+#endif
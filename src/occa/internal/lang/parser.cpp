@@ -1,6 +1,7 @@
 #include <occa/internal/io.hpp>
 #include <occa/internal/lang/attribute.hpp>
 #include <occa/internal/lang/expr.hpp>
+#include <occa/internal/lang/fileCache.hpp>
 #include <occa/internal/lang/parser.hpp>
 #include <occa/internal/lang/variable.hpp>
 #include <occa/internal/lang/builtins/attributes.hpp>
@@ -219,7 +220,7 @@ namespace occa {
       stream.clearCache();
 
       if (isFile) {
-        tokenizer.set(new file_t(source));
+        tokenizer.set(fileCache_t::getInstance().load(source));
       } else {
         tokenizer.set(source.c_str());
       }
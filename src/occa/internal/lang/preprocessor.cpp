@@ -11,6 +11,7 @@
 #include <occa/internal/lang/preprocessor.hpp>
 #include <occa/internal/lang/specialMacros.hpp>
 #include <occa/internal/lang/expr.hpp>
+#include <occa/internal/lang/fileCache.hpp>
 #include <occa/internal/lang/tokenizer.hpp>
 
 namespace occa {
@@ -161,6 +162,7 @@ namespace occa {
       sourceMacros.clear();
 
       dependencies.clear();
+      onceHeaders.clear();
     }
 
     preprocessor_t& preprocessor_t::operator = (const preprocessor_t &other) {
@@ -176,6 +178,7 @@ namespace occa {
       sourceMacros   = other.sourceMacros;
 
       dependencies = other.dependencies;
+      onceHeaders  = other.onceHeaders;
       warnings     = other.warnings;
       errors       = other.errors;
 
@@ -867,7 +870,7 @@ namespace occa {
       }
 
       // Freeze our outputs and expand the rest of our symbols
-      std::list<token_t*> prevOutputCache = outputCache;
+      tokenList prevOutputCache = outputCache;
       pushStatus(ppStatus::reading);
       outputCache.clear();
 
@@ -972,7 +975,7 @@ namespace occa {
 
     void preprocessor_t::freeAttributeOperatorTokens(token_t &opToken,
                                                      token_t &directiveToken,
-                                                     std::list<token_t*> &prevOutputCache) {
+                                                     tokenList &prevOutputCache) {
       delete &opToken;
       delete &directiveToken;
 
@@ -1390,9 +1393,22 @@ namespace occa {
         inputCache.pop_front();
       }
 
-      // Push source after updating origin to the [\n] token
       input->clearCache();
-      tokenizer->pushSource(header);
+
+      // Skip headers that were already included and guarded
+      //   by #pragma once or a defined include guard
+      file_t *file = fileCache_t::getInstance().load(header);
+      if (onceHeaders.count(file->expandedFilename)
+          || (file->includeGuard.size() && getMacro(file->includeGuard))) {
+        // Files outside of the cache aren't referenced by anything yet
+        if (!file->getRefs()) {
+          delete file;
+        }
+        return;
+      }
+
+      // Push source after updating origin to the [\n] token
+      tokenizer->pushSource(file);
     }
 
     void preprocessor_t::processPragma(identifierToken &directive) {
@@ -1408,6 +1424,14 @@ namespace occa {
         return;
       }
 
+      if ((tokenCount == 1)
+          && (lineTokens[0]->type() & tokenType::identifier)
+          && (((identifierToken*) lineTokens[0])->value == "once")) {
+        onceHeaders[directive.origin.file->expandedFilename] = true;
+        freeTokenVector(lineTokens);
+        return;
+      }
+
       const std::string value = stringifyTokens(lineTokens, true);
 
       pushOutput(new pragmaToken(directive.origin,
@@ -19,9 +19,9 @@ namespace occa {
 
     typedef std::set<std::string> stringSet;
 
-    typedef std::vector<token_t*> tokenVector;
-    typedef std::stack<token_t*>  tokenStack;
-    typedef std::list<token_t*>   tokenList;
+    typedef std::vector<token_t*>                         tokenVector;
+    typedef std::stack<token_t*>                          tokenStack;
+    typedef std::list<token_t*, arenaAllocator<token_t*>> tokenList;
 
     typedef std::map<std::string, macro_t*> macroMap;
     typedef std::map<macro_t*, bool>        macroSet;
@@ -70,6 +70,8 @@ namespace occa {
       occa::json settings;
 
       strToBoolMap dependencies;
+      // Expanded filenames of headers with #pragma once
+      strToBoolMap onceHeaders;
       int warnings, errors;
       //================================
 
@@ -167,7 +169,7 @@ namespace occa {
       void processAttributeOperator(operatorToken &opToken);
       void freeAttributeOperatorTokens(token_t &opToken,
                                        token_t &directiveToken,
-                                       std::list<token_t*> &prevOutputCache);
+                                       tokenList &prevOutputCache);
 
       bool lineIsTrue(identifierToken &directive,
                       bool &isTrue);
@@ -3,13 +3,13 @@
 namespace occa {
   namespace lang {
     printer::printer() :
-      ss(),
+      buffer(),
       out(NULL) {
       clear();
     }
 
     printer::printer(io::output &out_) :
-      ss(),
+      buffer(),
       out(&out_) {
       clear();
     }
@@ -19,19 +19,15 @@ namespace occa {
     }
 
     int printer::size() {
-      int pos = ss.tellg();
-      ss.seekg(0, ss.end);
-      int size = ss.tellg();
-      ss.seekg(pos);
-      return size;
+      return (int) buffer.size();
     }
 
     std::string printer::str() {
-      return ss.str();
+      return buffer;
     }
 
     void printer::clear() {
-      ss.str("");
+      buffer.clear();
       indent = "";
 
       inlinedStack.clear();
@@ -151,6 +147,49 @@ namespace occa {
       }
     }
 
+    void printer::print(const std::string &str) {
+      printChars(str.c_str(), (int) str.size());
+    }
+
+    void printer::print(const char c) {
+      printChars(&c, 1);
+    }
+
+    void printer::printChars(const char *c, const int chars) {
+      if (!chars) {
+        return;
+      }
+
+      for (int i = 0; i < chars; ++i) {
+        if (c[i] != '\n') {
+          ++charsFromNewline;
+        } else {
+          charsFromNewline = 0;
+        }
+      }
+
+      const int replacedLastChars = (
+        chars > lastCharsBufferSize
+        ? lastCharsBufferSize
+        : chars
+      );
+
+      // Slide remaining characters
+      for (int i = (lastCharsBufferSize - 1); i >= replacedLastChars; --i) {
+        lastChars[i] = lastChars[i - replacedLastChars];
+      }
+      // Replace with new last characters
+      for (int i = 0; i < replacedLastChars; ++i) {
+        lastChars[i] = c[chars - 1 - i];
+      }
+
+      if (out) {
+        *out << std::string(c, chars);
+      } else {
+        buffer.append(c, chars);
+      }
+    }
+
     printer& operator << (printer &pout,
                           const std::string &str) {
       pout.print(str);
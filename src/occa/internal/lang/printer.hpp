@@ -12,7 +12,7 @@ namespace occa {
   namespace lang {
     class printer {
     private:
-      std::stringstream ss;
+      std::string buffer;
       io::output *out;
 
       std::string indent;
@@ -59,52 +59,17 @@ namespace occa {
 
       template <class TM>
       void print(const TM &t) {
+        std::stringstream ss;
         ss << t;
-        const std::string str = ss.str();
-        const int chars = (int) str.size();
-        if (!chars) {
-          return;
-        }
-
-        int scanStart;
-        if (out) {
-          // Clear buffer
-          ss.str("");
-          scanStart = 0;
-        } else {
-          // We don't clear the buffer so no need to re-read past characters
-          scanStart = charsFromNewline;
-        }
-
-        const char *c_str = str.c_str();
-        for (int i = scanStart; i < chars; ++i) {
-          if (c_str[i] != '\n') {
-            ++charsFromNewline;
-          } else {
-            charsFromNewline = 0;
-          }
-        }
-
-        const int replacedLastChars = (
-          chars > lastCharsBufferSize
-          ? lastCharsBufferSize
-          : chars
-        );
-
-        // Slide remaining characters
-        for (int i = replacedLastChars; i < lastCharsBufferSize; ++i) {
-          lastChars[i] = lastChars[i - replacedLastChars];
-        }
-        // Replace with new last characters
-        for (int i = 0; i < replacedLastChars; ++i) {
-          lastChars[i] = c_str[chars - 1 - i];
-        }
-
-        if (out) {
-          // Print to buffer
-          *out << str;
-        }
+        print(ss.str());
       }
+
+      void print(const std::string &str);
+      void print(const char c);
+
+    private:
+      // Only scans the new characters, the buffer is never re-read
+      void printChars(const char *c, const int chars);
     };
 
     printer& operator << (printer &pout,
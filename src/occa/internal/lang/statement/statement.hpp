@@ -4,6 +4,7 @@
 #include <map>
 #include <vector>
 
+#include <occa/internal/lang/arena.hpp>
 #include <occa/internal/lang/attribute.hpp>
 #include <occa/internal/lang/printer.hpp>
 #include <occa/internal/lang/keyword.hpp>
@@ -88,6 +89,15 @@ namespace occa {
 
       virtual ~statement_t();
 
+      // Statements are allocated from the translation arena
+      inline void* operator new(const size_t bytes) {
+        return arena::allocate(bytes);
+      }
+
+      inline void operator delete(void *ptr, const size_t bytes) {
+        arena::release(ptr, bytes);
+      }
+
       template <class TM>
       inline bool is() const {
         return (dynamic_cast<const TM*>(this) != NULL);
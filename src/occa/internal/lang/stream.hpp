@@ -6,6 +6,7 @@
 
 #include <occa/types.hpp>
 #include <occa/types/json.hpp>
+#include <occa/internal/lang/arena.hpp>
 
 namespace occa {
   namespace lang {
@@ -150,7 +151,7 @@ namespace occa {
     template <class input_t, class output_t>
     class withInputCache : virtual public streamMap<input_t, output_t> {
      public:
-      std::list<input_t> inputCache;
+      std::list<input_t, arenaAllocator<input_t>> inputCache;
 
       withInputCache();
       withInputCache(const withInputCache<input_t, output_t> &other);
@@ -167,7 +168,7 @@ namespace occa {
     template <class input_t, class output_t>
     class withOutputCache : virtual public streamMap<input_t, output_t> {
      public:
-      std::list<output_t> outputCache;
+      std::list<output_t, arenaAllocator<output_t>> outputCache;
 
       withOutputCache();
       withOutputCache(const withOutputCache<input_t, output_t> &other);
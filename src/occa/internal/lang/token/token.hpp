@@ -2,6 +2,7 @@
 #define OCCA_INTERNAL_LANG_TOKEN_TOKEN_HEADER
 
 #include <occa/internal/io.hpp>
+#include <occa/internal/lang/arena.hpp>
 #include <occa/internal/lang/file.hpp>
 #include <occa/internal/lang/type.hpp>
 
@@ -77,6 +78,15 @@ namespace occa {
 
       virtual ~token_t();
 
+      // Tokens are allocated from the translation arena
+      inline void* operator new(const size_t bytes) {
+        return arena::allocate(bytes);
+      }
+
+      inline void operator delete(void *ptr, const size_t bytes) {
+        arena::release(ptr, bytes);
+      }
+
       template <class TM>
       inline bool is() const {
         return (dynamic_cast<const TM*>(this) != NULL);
@@ -1,5 +1,8 @@
+#include <algorithm>
+
 #include <occa/internal/utils/lex.hpp>
 #include <occa/internal/utils/string.hpp>
+#include <occa/internal/lang/fileCache.hpp>
 #include <occa/internal/lang/tokenizer.hpp>
 #include <occa/internal/lang/token.hpp>
 
@@ -100,6 +103,13 @@ namespace occa {
     }
 
     void tokenizer_t::setup() {
+      lastTokenType = tokenType::none;
+      lastNonNewlineTokenType = tokenType::none;
+      errors = 0;
+      warnings = 0;
+      printErrors = true;
+      cachedTokenIndex = 0;
+
       getOperators(operators);
       operators.freeze();
 
@@ -159,6 +169,8 @@ namespace occa {
       errors   = 0;
       warnings = 0;
 
+      cachedTokenIndex = 0;
+
       stack.clear();
       origin.clear();
 
@@ -171,7 +183,9 @@ namespace occa {
     }
 
     void tokenizer_t::printError(const std::string &message) {
-      origin.printError(message);
+      if (printErrors) {
+        origin.printError(message);
+      }
       ++errors;
     }
 
@@ -210,6 +224,10 @@ namespace occa {
     }
 
     void tokenizer_t::pushSource(const std::string &filename) {
+      pushSource(fileCache_t::getInstance().load(filename));
+    }
+
+    void tokenizer_t::pushSource(file_t *file) {
       // Delete tokens and rewind
       if (outputCache.size()) {
         origin = outputCache.front()->origin;
@@ -221,8 +239,6 @@ namespace occa {
         outputCache.clear();
       }
 
-      // TODO: Use a fileCache
-      file_t *file = new file_t(filename);
       origin.push(true,
                   *file,
                   file->content.c_str());
@@ -589,6 +605,11 @@ namespace occa {
         return new newlineToken(popTokenOrigin());
       }
 
+      token_t *cachedToken = getCachedToken();
+      if (cachedToken) {
+        return cachedToken;
+      }
+
       int type = peek();
       if (type & tokenType::identifier) {
         return getIdentifierToken();
@@ -618,6 +639,45 @@ namespace occa {
       return new unknownToken(popTokenOrigin());
     }
 
+    token_t* tokenizer_t::getCachedToken() {
+      const std::vector<cachedToken_t> &cachedTokens = origin.file->cachedTokens;
+      const size_t cachedTokenCount = cachedTokens.size();
+      if (!cachedTokenCount) {
+        return NULL;
+      }
+
+      // Tokens are usually read in order, otherwise find the token starting
+      //   at the current position (if any) since directives such as #include
+      //   move through the source without tokens
+      size_t index = cachedTokenIndex;
+      if ((index >= cachedTokenCount)
+          || (cachedTokens[index].token->origin.position.start != fp.start)) {
+        std::vector<cachedToken_t>::const_iterator it = std::lower_bound(
+          cachedTokens.begin(), cachedTokens.end(), fp.start,
+          [](const cachedToken_t &cached, const char *start) {
+            return cached.token->origin.position.start < start;
+          }
+        );
+        if ((it == cachedTokens.end())
+            || (it->token->origin.position.start != fp.start)) {
+          return NULL;
+        }
+        index = it - cachedTokens.begin();
+      }
+
+      const cachedToken_t &cached = cachedTokens[index];
+      cachedTokenIndex = index + 1;
+
+      // Keep the current include chain with the cached position
+      token_t *token = cached.token->clone();
+      token->origin = origin;
+      token->origin.position = cached.token->origin.position;
+
+      fp = cached.end;
+
+      return token;
+    }
+
     token_t* tokenizer_t::getIdentifierToken() {
       if (!lex::inCharset(*fp.start, charcodes::identifierStart)) {
         printError("Not able to parse identifier");
@@ -6,6 +6,7 @@
 
 #include <occa/internal/io.hpp>
 #include <occa/internal/utils/trie.hpp>
+#include <occa/internal/lang/arena.hpp>
 #include <occa/internal/lang/file.hpp>
 #include <occa/internal/lang/printer.hpp>
 #include <occa/internal/lang/stream.hpp>
@@ -14,10 +15,10 @@ namespace occa {
   namespace lang {
     class token_t;
 
-    typedef std::vector<token_t*>   tokenVector;
-    typedef std::list<token_t*>     tokenList;
-    typedef std::vector<fileOrigin> originVector;
-    typedef trie<const operator_t*> operatorTrie;
+    typedef std::vector<token_t*>                         tokenVector;
+    typedef std::list<token_t*, arenaAllocator<token_t*>> tokenList;
+    typedef std::vector<fileOrigin>                       originVector;
+    typedef trie<const operator_t*>                       operatorTrie;
 
     int getEncodingType(const std::string &str);
     int getCharacterEncoding(const std::string &str);
@@ -38,6 +39,10 @@ namespace occa {
       int lastTokenType;
       int lastNonNewlineTokenType;
       int errors, warnings;
+      bool printErrors;
+
+      // Hint for the next token in origin.file->cachedTokens
+      size_t cachedTokenIndex;
 
       tokenizer_t();
 
@@ -74,6 +79,7 @@ namespace occa {
       virtual void setNext(token_t *&out);
 
       void pushSource(const std::string &filename);
+      void pushSource(file_t *file);
       void popSource();
 
       void push();
@@ -103,6 +109,7 @@ namespace occa {
       void getRawString(std::string &value);
 
       token_t* getToken();
+      token_t* getCachedToken();
       token_t* getIdentifierToken();
       token_t* getPrimitiveToken();
       token_t* getOperatorToken();
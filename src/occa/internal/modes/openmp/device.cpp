@@ -22,36 +22,14 @@ namespace occa {
       return (
         serial::device::kernelHash(props)
         ^ occa::hash("openmp device::kernelHash")
+        ^ props["openmp/schedule"]
+        ^ props["openmp/chunk"]
+        ^ props["openmp/collapse"]
       );
     }
 
-    bool device::parseFile(const std::string &filename,
-                           const std::string &outputFile,
-                           const occa::json &kernelProps,
-                           lang::sourceMetadata_t &metadata) {
-      lang::okl::openmpParser parser(kernelProps);
-      parser.parseFile(filename);
-
-      // Verify if parsing succeeded
-      if (!parser.succeeded()) {
-        if (!kernelProps.get("silent", false)) {
-          OCCA_FORCE_ERROR("Unable to transform OKL kernel [" << filename << "]");
-        }
-        return false;
-      }
-
-      io::stageFile(
-        outputFile,
-        true,
-        [&](const std::string &tempFilename) -> bool {
-          parser.writeToFile(tempFilename);
-          return true;
-        }
-      );
-
-      parser.setSourceMetadata(metadata);
-
-      return true;
+    lang::okl::serialParser* device::createParser(const occa::json &props) const {
+      return new lang::okl::openmpParser(props);
     }
 
     modeKernel_t* device::buildKernel(const std::string &filename,
@@ -108,19 +86,25 @@ namespace occa {
         vendor = sys::compilerVendor(compiler);
       }
 
-      if (compiler != lastCompiler) {
-        lastCompiler = compiler;
-        lastCompilerOpenMPFlag = openmp::compilerFlag(vendor, compiler);
-
-        if (lastCompilerOpenMPFlag == openmp::notSupported) {
-          io::stderr << "Compiler [" << (std::string) allKernelProps["compiler"]
-                     << "] does not support OpenMP, defaulting to [Serial] mode\n";
+      std::string compilerOpenMPFlag;
+      {
+        // Kernels can be built concurrently through occa::device::buildKernels
+        std::lock_guard<std::mutex> lock(lastCompilerMutex);
+        if (compiler != lastCompiler) {
+          lastCompiler = compiler;
+          lastCompilerOpenMPFlag = openmp::compilerFlag(vendor, compiler);
+
+          if (lastCompilerOpenMPFlag == openmp::notSupported) {
+            io::stderr << "Compiler [" << (std::string) allKernelProps["compiler"]
+                       << "] does not support OpenMP, defaulting to [Serial] mode\n";
+          }
         }
+        compilerOpenMPFlag = lastCompilerOpenMPFlag;
       }
 
-      const bool usingOpenMP = (lastCompilerOpenMPFlag != openmp::notSupported);
+      const bool usingOpenMP = (compilerOpenMPFlag != openmp::notSupported);
       if (usingOpenMP) {
-        allKernelProps["compiler_flags"] += " " + lastCompilerOpenMPFlag;
+        allKernelProps["compiler_flags"] += " " + compilerOpenMPFlag;
       }
 
       modeKernel_t *k = serial::device::buildKernel(filename,
@@ -1,6 +1,8 @@
 #ifndef OCCA_INTERNAL_MODES_OPENMP_DEVICE_HEADER
 #define OCCA_INTERNAL_MODES_OPENMP_DEVICE_HEADER
 
+#include <mutex>
+
 #include <occa/internal/modes/serial/device.hpp>
 
 namespace occa {
@@ -11,6 +13,7 @@ namespace occa {
       //   due to compiler changes
       std::string lastCompiler;
       std::string lastCompilerOpenMPFlag;
+      std::mutex lastCompilerMutex;
 
     public:
       device(const occa::json &properties_);
@@ -20,10 +23,7 @@ namespace occa {
 
       hash_t kernelHash(const occa::json &props) const override;
 
-      bool parseFile(const std::string &filename,
-                     const std::string &outputFile,
-                     const occa::json &kernelProps,
-                     lang::sourceMetadata_t &metadata) override;
+      lang::okl::serialParser* createParser(const occa::json &props) const override;
 
       modeKernel_t* buildKernel(const std::string &filename,
                                 const std::string &kernelName,
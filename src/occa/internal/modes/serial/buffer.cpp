@@ -1,5 +1,6 @@
 #include <cstring>
 #include <occa/internal/modes/serial/buffer.hpp>
+#include <occa/internal/modes/serial/device.hpp>
 #include <occa/internal/modes/serial/memory.hpp>
 #include <occa/internal/utils/sys.hpp>
 #include <occa/internal/core/device.hpp>
@@ -12,6 +13,10 @@ namespace occa {
       occa::modeBuffer_t(modeDevice_, size_, properties_) {}
 
     buffer::~buffer() {
+      // Queued kernels and copies could still be using the buffer
+      if (modeDevice) {
+        ((device*) modeDevice)->waitForStreams();
+      }
 
       if (!isWrapped && ptr) {
         if (properties.get("use_host_pointer", false)) {
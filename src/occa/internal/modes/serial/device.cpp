@@ -1,8 +1,18 @@
+#include <atomic>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include <occa/core/base.hpp>
+#include <occa/utils/exception.hpp>
 #include <occa/internal/utils/env.hpp>
 #include <occa/internal/io.hpp>
 #include <occa/internal/utils/sys.hpp>
 #include <occa/internal/modes/serial/device.hpp>
+#include <occa/internal/modes/serial/jit.hpp>
 #include <occa/internal/modes/serial/kernel.hpp>
 #include <occa/internal/modes/serial/buffer.hpp>
 #include <occa/internal/modes/serial/memory.hpp>
@@ -13,12 +23,358 @@
 
 namespace occa {
   namespace serial {
+    namespace {
+      // Objects are cached by their source and compile command,
+      //   so kernels that didn't change are linked without recompiling them
+      void compileObject(const std::string &source,
+                         const std::string &objectFilename,
+                         const std::string &compileCommand,
+                         const std::string &kernelName,
+                         const bool verbose) {
+        io::stageFiles(
+          { io::dirname(objectFilename) + kc::objectSourceFile, objectFilename },
+          true,
+          [&](const strVector &tempFilenames) -> bool {
+            const std::string &tempSourceFilename = tempFilenames[0];
+            const std::string &tempObjectFilename = tempFilenames[1];
+
+            io::write(tempSourceFilename, source);
+
+            const std::string sCommand = (
+              compileCommand
+              + " -c " + tempSourceFilename
+              + " -o " + tempObjectFilename
+            );
+            if (verbose) {
+              io::stdout << "Compiling object for [" << kernelName << "]\n" << sCommand << "\n";
+            }
+
+            std::string commandOutput;
+            const int commandExitCode = sys::call(
+              (sCommand + " 2>&1").c_str(),
+              commandOutput
+            );
+
+            if (commandExitCode) {
+              OCCA_FORCE_ERROR(
+                "Error compiling [" << kernelName << "],"
+                " Command: [" << sCommand << "]\n"
+                << "Output:\n\n"
+                << commandOutput << "\n"
+              );
+            }
+            return true;
+          }
+        );
+      }
+
+      // Returns the leading #include <...> and using-namespace lines
+      std::string getLeadingHeaders(const std::string &source) {
+        std::string headers;
+        for (std::string line : split(source, '\n')) {
+          strip(line);
+          if (!line.size()) {
+            continue;
+          }
+          const bool isHeader = (
+            startsWith(line, "#include <")
+            || (startsWith(line, "using namespace ") && endsWith(line, ";"))
+          );
+          if (!isHeader) {
+            break;
+          }
+          headers += line + '\n';
+        }
+        return headers;
+      }
+
+      // Precompiled header keys that failed to compile in this process
+      std::mutex failedHeadersMutex;
+      std::set<hash_t> failedHeaders;
+
+      // Files listed in a make-style dependency file written by -MD -MF
+      strVector readDependencyFile(const std::string &filename) {
+        strVector dependencies;
+        if (!io::isFile(filename)) {
+          return dependencies;
+        }
+        const std::string contents = io::read(filename);
+        const size_t chars = contents.size();
+
+        std::string entry;
+        auto addEntry = [&]() {
+          // Skip targets, including the phony ones added by -MP
+          if (entry.size() && !endsWith(entry, ":")) {
+            dependencies.push_back(entry);
+          }
+          entry.clear();
+        };
+
+        for (size_t i = 0; i < chars; ++i) {
+          const char c = contents[i];
+          const char next = (i + 1 < chars) ? contents[i + 1] : '\0';
+
+          if (c == '\\') {
+            if ((next == '\n') || (next == '\r')) {
+              // Line continuation
+              addEntry();
+              continue;
+            }
+            if ((next == ' ') || (next == '#')) {
+              // Escaped character in a filename
+              entry += next;
+              ++i;
+              continue;
+            }
+          } else if ((c == '$') && (next == '$')) {
+            entry += '$';
+            ++i;
+            continue;
+          } else if ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r')) {
+            addEntry();
+            continue;
+          }
+          entry += c;
+        }
+        addEntry();
+
+        return dependencies;
+      }
+
+      // Same as occa::device::applyDependencyHash, edited headers move the
+      //   precompiled header to a new hash directory
+      hash_t applyHeaderDependencyHash(hash_t headerHash) {
+        while (true) {
+          const std::string buildFile = io::hashDir(headerHash) + kc::buildFile;
+          if (!io::isFile(buildFile)) {
+            return headerHash;
+          }
+
+          json buildJson = json::read(buildFile);
+          json &dependenciesJson = buildJson["dependencies"];
+          if (!dependenciesJson.isObject()) {
+            return headerHash;
+          }
+
+          hash_t newHeaderHash = headerHash;
+          bool foundDependencyChanges = false;
+          for (const auto &it : dependenciesJson.object()) {
+            if (!io::exists(it.first)) {
+              foundDependencyChanges = true;
+              continue;
+            }
+            const hash_t dependencyHash = hashFile(it.first);
+            newHeaderHash ^= dependencyHash;
+            foundDependencyChanges |= (dependencyHash != hash_t::fromString(it.second));
+          }
+
+          if (!foundDependencyChanges) {
+            return headerHash;
+          }
+          headerHash = newHeaderHash;
+        }
+      }
+
+      // Precompiles the headers the source starts with, cached by the headers,
+      //   the contents of the files they include and the compile command
+      //   so later kernels skip parsing them
+      // Returns the header to pass through -include, or "" if there isn't one
+      std::string getPrecompiledHeader(const std::string &source,
+                                       const std::string &compileCommand,
+                                       const hash_t &deviceHash,
+                                       const int compilerVendor,
+                                       const int compilerLanguageFlag,
+                                       const bool verbose) {
+        const std::string suffix = sys::compilerPrecompiledHeaderSuffix(compilerVendor);
+        const std::string headers = getLeadingHeaders(source);
+        if (!suffix.size() || !headers.size()) {
+          return "";
+        }
+
+        const hash_t headerHash = applyHeaderDependencyHash(
+          deviceHash
+          ^ occa::hash(headers)
+          ^ occa::hash(compileCommand)
+        );
+        {
+          std::lock_guard<std::mutex> lock(failedHeadersMutex);
+          if (failedHeaders.count(headerHash)) {
+            return "";
+          }
+        }
+
+        const std::string hashDir = io::hashDir(headerHash);
+        const std::string headerFilename = hashDir + kc::precompiledHeader;
+        const std::string binaryFilename = headerFilename + suffix;
+        const std::string headerLanguage = (
+          (compilerLanguageFlag == sys::language::C)
+          ? "c-header"
+          : "c++-header"
+        );
+
+        // Compilers validate the header path, so only the binary is staged
+        io::stageFile(
+          headerFilename,
+          true,
+          [&](const std::string &tempFilename) -> bool {
+            io::write(tempFilename, headers);
+            return true;
+          }
+        );
+
+        strVector dependencies;
+        io::stageFiles(
+          { binaryFilename, hashDir + kc::precompiledHeaderDependencies },
+          true,
+          [&](const strVector &tempFilenames) -> bool {
+            const std::string sCommand = (
+              compileCommand
+              + " -x " + headerLanguage + ' ' + headerFilename
+              + " -o " + tempFilenames[0]
+              + " -MD -MF " + tempFilenames[1]
+            );
+            if (verbose) {
+              io::stdout << "Precompiling headers\n" << sCommand << "\n";
+            }
+
+            // Kernels still compile without it, just slower
+            std::string commandOutput;
+            if (sys::call((sCommand + " 2>&1").c_str(), commandOutput)) {
+              return false;
+            }
+            dependencies = readDependencyFile(tempFilenames[1]);
+            return true;
+          }
+        );
+
+        if (!io::isFile(binaryFilename)) {
+          std::lock_guard<std::mutex> lock(failedHeadersMutex);
+          failedHeaders.insert(headerHash);
+          return "";
+        }
+
+        // Record the included files so edits to them are picked up
+        if (dependencies.size()) {
+          io::stageFile(
+            hashDir + kc::buildFile,
+            true,
+            [&](const std::string &tempFilename) -> bool {
+              json buildJson;
+              jsonObject &dependencyHashes = buildJson["dependencies"].object();
+              for (const std::string &dependency : dependencies) {
+                dependencyHashes[dependency] = hashFile(dependency).getFullString();
+              }
+              buildJson.write(tempFilename);
+              return true;
+            }
+          );
+        }
+
+        return headerFilename;
+      }
+
+      // Threads compiling objects across all builds, including the calling threads
+      //   Kernels can be built concurrently (e.g. by device::buildKernels)
+      //   so helper threads are only added while cores are free
+      std::atomic<int> compileThreads(0);
+
+      int reserveCompileThreads(const int wantedThreads) {
+        const int maxThreads = std::max(1, (int) std::thread::hardware_concurrency());
+        int activeThreads = compileThreads.load();
+        int threads;
+        do {
+          threads = std::min(wantedThreads, maxThreads - activeThreads);
+          if (threads <= 0) {
+            return 0;
+          }
+        } while (!compileThreads.compare_exchange_weak(activeThreads,
+                                                       activeThreads + threads));
+        return threads;
+      }
+
+      strVector compileObjects(const strVector &sources,
+                               const std::string &compileCommand,
+                               const hash_t &deviceHash,
+                               const std::string &kernelName,
+                               const bool verbose) {
+        const int sourceCount = (int) sources.size();
+        const hash_t commandHash = deviceHash ^ occa::hash(compileCommand);
+
+        strVector objectFilenames;
+        std::vector<int> missingObjects;
+        for (int i = 0; i < sourceCount; ++i) {
+          const std::string objectFilename = (
+            io::hashDir(occa::hash(sources[i]) ^ commandHash) + kc::objectFile
+          );
+          objectFilenames.push_back(objectFilename);
+          if (!io::isFile(objectFilename)) {
+            missingObjects.push_back(i);
+          }
+        }
+
+        const int missingCount = (int) missingObjects.size();
+        if (verbose) {
+          io::stdout << "Reusing [" << (sourceCount - missingCount) << '/' << sourceCount
+                     << "] cached objects for [" << kernelName << "]\n";
+        }
+
+        // Compile the missing objects concurrently
+        std::atomic<int> nextObject(0);
+        std::exception_ptr compileError;
+        std::mutex compileErrorMutex;
+        auto compileMissingObjects = [&]() {
+          int index;
+          while ((index = nextObject++) < missingCount) {
+            const int i = missingObjects[index];
+            try {
+              compileObject(sources[i],
+                            objectFilenames[i],
+                            compileCommand,
+                            kernelName,
+                            verbose);
+            } catch (...) {
+              std::lock_guard<std::mutex> lock(compileErrorMutex);
+              if (!compileError) {
+                compileError = std::current_exception();
+              }
+            }
+          }
+        };
+
+        // The calling thread always compiles
+        ++compileThreads;
+        const int helperThreads = reserveCompileThreads(missingCount - 1);
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < helperThreads; ++i) {
+          threads.emplace_back(compileMissingObjects);
+        }
+        compileMissingObjects();
+        for (std::thread &thread : threads) {
+          thread.join();
+        }
+        compileThreads -= (helperThreads + 1);
+
+        if (compileError) {
+          std::rethrow_exception(compileError);
+        }
+
+        return objectFilenames;
+      }
+    }
+
     device::device(const occa::json &properties_) :
       occa::modeDevice_t(properties_) {
       // TODO: Maybe theres something more descriptive we can populate here
       arch = std::string("CPU");
     }
 
+    device::~device() {
+      for (auto &it : modules) {
+        delete it.second;
+      }
+    }
+
     bool device::hasSeparateMemorySpace() const {
       return false;
     }
@@ -54,10 +410,23 @@ namespace occa {
     }
 
     occa::streamTag device::tagStream() {
-      return new occa::serial::streamTag(this, sys::currentTime());
+      // The time is recorded when the stream reaches the tag
+      std::shared_ptr<std::promise<double>> time = std::make_shared<std::promise<double>>();
+      occa::serial::streamTag *tag = new occa::serial::streamTag(this, time->get_future().share());
+
+      getStream().enqueue([time]() {
+        time->set_value(sys::currentTime());
+      });
+
+      return tag;
     }
 
-    void device::waitFor(occa::streamTag tag) {}
+    void device::waitFor(occa::streamTag tag) {
+      occa::serial::streamTag *srTag = (
+        dynamic_cast<occa::serial::streamTag*>(tag.getModeStreamTag())
+      );
+      srTag->time.wait();
+    }
 
     double device::timeBetween(const occa::streamTag &startTag,
                                const occa::streamTag &endTag) {
@@ -68,16 +437,42 @@ namespace occa {
         dynamic_cast<occa::serial::streamTag*>(endTag.getModeStreamTag())
       );
 
-      return (srEndTag->time - srStartTag->time);
+      return (srEndTag->getTime() - srStartTag->getTime());
+    }
+
+    stream& device::getStream() const {
+      return *((stream*) currentStream.getModeStream());
+    }
+
+    void device::waitForStreams() const {
+      if (!streamRing.head) {
+        return;
+      }
+      modeStream_t *start = (modeStream_t*) streamRing.head;
+      modeStream_t *current = start;
+      do {
+        ((stream*) current)->wait();
+        current = (modeStream_t*) current->rightRingEntry;
+      } while (current != start);
     }
     //==================================
 
     //---[ Kernel ]---------------------
+    bool device::canBuildKernelsConcurrently() const {
+      return true;
+    }
+
+    lang::okl::serialParser* device::createParser(const occa::json &props) const {
+      return new lang::okl::serialParser(props);
+    }
+
     bool device::parseFile(const std::string &filename,
                            const std::string &outputFile,
                            const occa::json &kernelProps,
-                           lang::sourceMetadata_t &metadata) {
-      lang::okl::serialParser parser(kernelProps);
+                           lang::sourceMetadata_t &metadata,
+                           strVector *kernelSources) {
+      std::unique_ptr<lang::okl::serialParser> parserPtr(createParser(kernelProps));
+      lang::okl::serialParser &parser = *parserPtr;
       parser.parseFile(filename);
 
       // Verify if parsing succeeded
@@ -98,6 +493,10 @@ namespace occa {
 
       parser.setSourceMetadata(metadata);
 
+      if (kernelSources) {
+        parser.splitKernelSources(*kernelSources);
+      }
+
       return true;
     }
 
@@ -150,6 +549,31 @@ namespace occa {
         return k;
       }
 
+      // Objects compiled in process are linked by the JIT when loading them
+      //   The JIT is opt-in until it's used more widely
+      const bool useJit = kernelProps.get("kernel/jit", false) && jit::isEnabled();
+      const std::string jitObjectFilename = hashDir + (
+        isLauncherKernel
+        ? kc::launcherJitObject
+        : kc::jitObject
+      );
+      if (useJit && io::isFile(jitObjectFilename)) {
+        if (verbose) {
+          io::stdout << "Loading cached ["
+                     << kernelName
+                     << "] from ["
+                     << filename
+                     << "] in [" << jitObjectFilename << "]\n";
+        }
+        modeKernel_t *k = buildKernelFromModule(loadModule(jitObjectFilename, NULL, true),
+                                                kernelName,
+                                                kernelProps);
+        if (k) {
+          k->sourceFilename = filename;
+        }
+        return k;
+      }
+
       std::string compilerLanguage;
       std::string compiler;
       std::string compilerFlags;
@@ -270,8 +694,18 @@ namespace occa {
         sys::addCompilerFlags(compilerFlags, sys::compilerC99Flags(compilerVendor));
       }
 
+      // Compile each @kernel into its own cached object and link them
+      //   The whole file is still translated, only compiling is per kernel,
+      //   so it's opt-in until translation is per kernel too
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      const bool buildIncrementally = kernelProps.get("kernel/incremental", false);
+#else
+      const bool buildIncrementally = false;
+#endif
+
       std::string sourceFilename;
       lang::sourceMetadata_t metadata;
+      strVector kernelSources;
 
       if (isLauncherKernel) {
         sourceFilename = filename;
@@ -289,7 +723,8 @@ namespace occa {
           bool valid = parseFile(sourceFilename,
                                  outputFile,
                                  kernelProps,
-                                 metadata);
+                                 metadata,
+                                 buildIncrementally ? &kernelSources : NULL);
           if (!valid) {
             return NULL;
           }
@@ -317,15 +752,83 @@ namespace occa {
       const bool includeOcca = kernelProps.get("kernel/include_occa", isLauncherKernel);
       const bool linkOcca    = kernelProps.get("kernel/link_occa", isLauncherKernel);
 
+      // libocca is already loaded, so only the include paths are needed
+      //   The whole source is compiled at once in process, so per-kernel objects
+      //   and precompiled headers only apply to builds through the compiler
+      if (useJit && jit::canCompile(compilerVendor, compilerFlags, compilerLinkerFlags)) {
+        std::string jitCompilerFlags = compilerFlags;
+        if (includeOcca) {
+          jitCompilerFlags += (
+            " -I" + env::OCCA_DIR + "include"
+            " -I" + env::OCCA_INSTALL_DIR + "include"
+          );
+        }
+
+        modeKernel_t *k = buildJitKernel(sourceFilename,
+                                         jitObjectFilename,
+                                         jitCompilerFlags,
+                                         kernelName,
+                                         kernelProps,
+                                         metadata);
+        if (k) {
+          k->sourceFilename = filename;
+          return k;
+        }
+      }
+
+      strVector objectFilenames;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      // Compile command for precompiled headers and objects
+      std::string compileCommand = compiler + ' ' + compilerFlags;
+      if (compilerEnvScript.size()) {
+        compileCommand = compilerEnvScript + " && " + compileCommand;
+      }
+      if (includeOcca) {
+        compileCommand += (
+          " -I" + env::OCCA_DIR + "include"
+          " -I" + env::OCCA_INSTALL_DIR + "include"
+        );
+      }
+
+      if (kernelProps.get("kernel/precompiled_header", true)) {
+        const std::string precompiledHeader = getPrecompiledHeader(
+          kernelSources.size() ? kernelSources[0] : io::read(sourceFilename),
+          compileCommand,
+          versionedHash(),
+          compilerVendor,
+          compilerLanguageFlag,
+          verbose
+        );
+        if (precompiledHeader.size()) {
+          compilerFlags += " -include " + precompiledHeader;
+          compileCommand += " -include " + precompiledHeader;
+        }
+      }
+
+      if (kernelSources.size()) {
+        objectFilenames = compileObjects(kernelSources,
+                                         compileCommand,
+                                         versionedHash(),
+                                         kernelName,
+                                         verbose);
+      }
+#endif
+
       io::stageFile(
         binaryFilename,
         true,
         [&](const std::string &tempFilename) -> bool {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
           command << compiler
-                  << ' '    << compilerFlags
-                  << ' '    << sourceFilename
-                  << " -o " << tempFilename;
+                  << ' '    << compilerFlags;
+          if (objectFilenames.size()) {
+            for (const std::string &objectFilename : objectFilenames) {
+              command << ' ' << objectFilename;
+            }
+          } else {
+            command << ' ' << sourceFilename;
+          }
+          command << " -o " << tempFilename;
           if (includeOcca) {
             command << " -I"  << env::OCCA_DIR << "include"
                     << " -I"  << env::OCCA_INSTALL_DIR << "include";
@@ -389,51 +892,133 @@ namespace occa {
 
       io::sync(binaryFilename);
 
-      modeKernel_t *k = buildKernelFromBinary(binaryFilename,
+      // Reuse the metadata from parsing instead of reading the build file
+      modeKernel_t *k = buildKernelFromModule(loadModule(binaryFilename, &metadata),
                                               kernelName,
-                                              kernelProps,
-                                              metadata.kernelsMetadata[kernelName]);
+                                              kernelProps);
       if (k) {
         k->sourceFilename = filename;
       }
       return k;
     }
 
-    modeKernel_t* device::buildKernelFromBinary(const std::string &filename,
-                                                const std::string &kernelName,
-                                                const occa::json &kernelProps) {
-      std::string buildFile = io::dirname(filename);
-      buildFile += kc::buildFile;
+    modeKernel_t* device::buildJitKernel(const std::string &sourceFilename,
+                                         const std::string &objectFilename,
+                                         const std::string &compilerFlags,
+                                         const std::string &kernelName,
+                                         const occa::json &kernelProps,
+                                         const lang::sourceMetadata_t &metadata) {
+      const bool verbose = kernelProps.get("verbose", false);
+
+      std::string errors;
+      io::stageFile(
+        objectFilename,
+        true,
+        [&](const std::string &tempFilename) -> bool {
+          if (verbose) {
+            io::stdout << "Compiling [" << kernelName << "] in process\n"
+                       << compilerFlags << ' ' << sourceFilename << "\n";
+          }
+          return jit::compile(sourceFilename,
+                              compilerFlags,
+                              tempFilename,
+                              errors);
+        }
+      );
+
+      if (io::isFile(objectFilename)) {
+        try {
+          return buildKernelFromModule(loadModule(objectFilename, &metadata, true),
+                                       kernelName,
+                                       kernelProps);
+        } catch (occa::exception &exception) {
+          errors = exception.message;
+        }
+        // Keep later builds from loading an object the JIT can't link
+        sys::rmrf(objectFilename);
+      }
 
-      lang::kernelMetadata_t metadata;
-      if (io::isFile(buildFile)) {
-        lang::sourceMetadata_t sourceMetadata = lang::sourceMetadata_t::fromBuildFile(buildFile);
-        metadata = sourceMetadata.kernelsMetadata[kernelName];
+      // The compiler process reports the same errors if the source is at fault
+      if (verbose) {
+        io::stdout << "Falling back to the compiler for [" << kernelName << "]\n"
+                   << errors << "\n";
       }
+      return NULL;
+    }
 
-      return buildKernelFromBinary(filename,
+    modeKernel_t* device::buildKernelFromBinary(const std::string &filename,
+                                                const std::string &kernelName,
+                                                const occa::json &kernelProps) {
+      return buildKernelFromModule(loadModule(filename),
                                    kernelName,
-                                   kernelProps,
-                                   metadata);
+                                   kernelProps);
     }
 
-    modeKernel_t* device::buildKernelFromBinary(const std::string &filename,
+    modeKernel_t* device::buildKernelFromModule(module *kernelModule,
                                                 const std::string &kernelName,
-                                                const occa::json &kernelProps,
-                                                lang::kernelMetadata_t &metadata) {
-      kernel &k = *(new kernel(this,
-                               kernelName,
-                               filename,
-                               kernelProps));
+                                                const occa::json &kernelProps) {
+      functionPtr_t function;
+      try {
+        function = kernelModule->getFunction(kernelName);
+      } catch (...) {
+        removeModuleRef(kernelModule);
+        throw;
+      }
 
-      k.binaryFilename = filename;
-      k.metadata = metadata;
+      kernel &k = *(newKernel(kernelName,
+                              kernelModule->binaryFilename,
+                              kernelProps));
 
-      k.dlHandle = sys::dlopen(filename);
-      k.function = sys::dlsym(k.dlHandle, kernelName);
+      k.binaryFilename = kernelModule->binaryFilename;
+      k.metadata = kernelModule->getKernelMetadata(kernelName);
+      k.kernelModule = kernelModule;
+      k.function = function;
 
       return &k;
     }
+
+    kernel* device::newKernel(const std::string &kernelName,
+                              const std::string &binaryFilename,
+                              const occa::json &kernelProps) {
+      return new kernel(this,
+                        kernelName,
+                        binaryFilename,
+                        kernelProps);
+    }
+
+    module* device::loadModule(const std::string &binaryFilename,
+                               const lang::sourceMetadata_t *metadata,
+                               const bool isJitObject) {
+      std::lock_guard<std::mutex> lock(modulesMutex);
+
+      module *&kernelModule = modules[binaryFilename];
+      if (!kernelModule) {
+        try {
+          kernelModule = new module(
+            binaryFilename,
+            (metadata
+             ? *metadata
+             : lang::sourceMetadata_t::fromBuildFile(io::dirname(binaryFilename) + kc::buildFile)),
+            isJitObject
+          );
+        } catch (...) {
+          modules.erase(binaryFilename);
+          throw;
+        }
+      }
+      ++kernelModule->refs;
+
+      return kernelModule;
+    }
+
+    void device::removeModuleRef(module *kernelModule) {
+      std::lock_guard<std::mutex> lock(modulesMutex);
+
+      if (--kernelModule->refs == 0) {
+        modules.erase(kernelModule->binaryFilename);
+        delete kernelModule;
+      }
+    }
     //==================================
 
     //---[ Memory ]-------------------
@@ -1,17 +1,29 @@
 #ifndef OCCA_INTERNAL_MODES_SERIAL_DEVICE_HEADER
 #define OCCA_INTERNAL_MODES_SERIAL_DEVICE_HEADER
 
+#include <map>
+#include <mutex>
+
 #include <occa/defines.hpp>
 #include <occa/internal/core/device.hpp>
+#include <occa/internal/lang/modes/serial.hpp>
+#include <occa/internal/modes/serial/module.hpp>
 
 namespace occa {
   namespace serial {
+    class kernel;
+    class stream;
+
     class device : public occa::modeDevice_t {
       mutable hash_t hash_;
 
+      // Loaded binaries, shared by kernels built from the same source file
+      std::map<std::string, module*> modules;
+      std::mutex modulesMutex;
+
     public:
       device(const occa::json &properties_);
-      virtual ~device() = default;
+      virtual ~device();
 
       bool hasSeparateMemorySpace() const override;
 
@@ -27,13 +39,26 @@ namespace occa {
       void waitFor(streamTag tag) override;
       double timeBetween(const streamTag &startTag,
                          const streamTag &endTag) override;
+
+      // Kernels and copies are queued on the current stream
+      stream& getStream() const;
+
+      // Waits for all streams without rethrowing their errors,
+      //   used before freeing anything queued work could still touch
+      void waitForStreams() const;
       //================================
 
       //---[ Kernel ]-------------------
-      virtual bool parseFile(const std::string &filename,
-                             const std::string &outputFile,
-                             const occa::json &kernelProps,
-                             lang::sourceMetadata_t &metadata);
+      bool canBuildKernelsConcurrently() const override;
+
+      virtual lang::okl::serialParser* createParser(const occa::json &props) const;
+
+      // Kernel sources are only set when @kernels can be compiled separately
+      bool parseFile(const std::string &filename,
+                     const std::string &outputFile,
+                     const occa::json &kernelProps,
+                     lang::sourceMetadata_t &metadata,
+                     strVector *kernelSources = NULL);
 
       modeKernel_t* buildKernel(const std::string &filename,
                                 const std::string &kernelName,
@@ -54,10 +79,27 @@ namespace occa {
                                           const std::string &kernelName,
                                           const occa::json &kernelProps) override;
 
-      virtual modeKernel_t* buildKernelFromBinary(const std::string &filename,
-                                                  const std::string &kernelName,
-                                                  const occa::json &kernelProps,
-                                                  lang::kernelMetadata_t &metadata);
+      // Returns NULL if the kernel couldn't be compiled or linked in process
+      modeKernel_t* buildJitKernel(const std::string &sourceFilename,
+                                   const std::string &objectFilename,
+                                   const std::string &compilerFlags,
+                                   const std::string &kernelName,
+                                   const occa::json &kernelProps,
+                                   const lang::sourceMetadata_t &metadata);
+
+      modeKernel_t* buildKernelFromModule(module *kernelModule,
+                                          const std::string &kernelName,
+                                          const occa::json &kernelProps);
+
+      virtual kernel* newKernel(const std::string &kernelName,
+                                const std::string &binaryFilename,
+                                const occa::json &kernelProps);
+
+      module* loadModule(const std::string &binaryFilename,
+                         const lang::sourceMetadata_t *metadata = NULL,
+                         const bool isJitObject = false);
+
+      void removeModuleRef(module *kernelModule);
       //================================
 
       //---[ Memory ]-------------------
@@ -0,0 +1,239 @@
+#include <occa/internal/modes/serial/jit.hpp>
+#include <occa/internal/utils/string.hpp>
+
+#if OCCA_CLANG_JIT_ENABLED
+#  include <memory>
+#  include <mutex>
+
+#  include <clang/Basic/Diagnostic.h>
+#  include <clang/Basic/DiagnosticOptions.h>
+#  include <clang/CodeGen/CodeGenAction.h>
+#  include <clang/Driver/Compilation.h>
+#  include <clang/Driver/Driver.h>
+#  include <clang/Driver/Job.h>
+#  include <clang/Driver/Tool.h>
+#  include <clang/Frontend/CompilerInstance.h>
+#  include <clang/Frontend/CompilerInvocation.h>
+#  include <clang/Frontend/TextDiagnosticPrinter.h>
+#  include <llvm/Config/llvm-config.h>
+#  include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#  include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#  include <llvm/Support/Host.h>
+#  include <llvm/Support/MemoryBuffer.h>
+#  include <llvm/Support/TargetSelect.h>
+#  include <llvm/Support/raw_ostream.h>
+
+// The driver finds its resource directory and the system headers
+//   relative to the clang executable
+#  ifndef OCCA_CLANG_EXECUTABLE
+#    define OCCA_CLANG_EXECUTABLE "clang"
+#  endif
+#endif
+
+namespace occa {
+  namespace serial {
+    namespace jit {
+      program::~program() {}
+
+#if OCCA_CLANG_JIT_ENABLED
+      namespace {
+        void initializeTargets() {
+          static std::once_flag initialized;
+          std::call_once(initialized, []() {
+            llvm::InitializeNativeTarget();
+            llvm::InitializeNativeTargetAsmPrinter();
+            llvm::InitializeNativeTargetAsmParser();
+          });
+        }
+
+        class orcProgram : public program {
+          std::unique_ptr<llvm::orc::LLJIT> session;
+
+        public:
+          orcProgram(std::unique_ptr<llvm::orc::LLJIT> session_) :
+            session(std::move(session_)) {}
+
+          ~orcProgram() {
+#  if LLVM_VERSION_MAJOR >= 11
+            // Run static destructors before the object is unloaded
+            if (llvm::Error error = session->deinitialize(session->getMainJITDylib())) {
+              llvm::consumeError(std::move(error));
+            }
+#  endif
+          }
+
+          functionPtr_t getFunction(const std::string &functionName) override {
+            auto symbol = session->lookup(functionName);
+            if (!symbol) {
+              llvm::consumeError(symbol.takeError());
+              return NULL;
+            }
+#  if LLVM_VERSION_MAJOR >= 15
+            return symbol->toPtr<functionPtr_t>();
+#  else
+            return (functionPtr_t) symbol->getAddress();
+#  endif
+          }
+        };
+      }
+#endif
+
+      bool isEnabled() {
+        return OCCA_CLANG_JIT_ENABLED;
+      }
+
+      bool canCompile(const int compilerVendor,
+                      const std::string &compilerFlags,
+                      const std::string &compilerLinkerFlags) {
+        if (!isEnabled()
+            || !(compilerVendor & (sys::vendor::GNU | sys::vendor::LLVM))
+            || strip(compilerLinkerFlags).size()) {
+          return false;
+        }
+
+        // Flags needing runtime libraries the process might not have loaded
+        for (const std::string &flag : split(compilerFlags, ' ')) {
+          if (startsWith(flag, "-fopenmp")
+              || startsWith(flag, "-fsanitize")
+              || startsWith(flag, "-l")
+              || startsWith(flag, "-L")
+              || startsWith(flag, "-Wl,")) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      bool compile(const std::string &sourceFilename,
+                   const std::string &compilerFlags,
+                   const std::string &objectFilename,
+                   std::string &errors) {
+#if OCCA_CLANG_JIT_ENABLED
+        initializeTargets();
+
+        llvm::raw_string_ostream errorStream(errors);
+        llvm::IntrusiveRefCntPtr<clang::DiagnosticOptions> diagnosticOptions(
+          new clang::DiagnosticOptions()
+        );
+        clang::DiagnosticsEngine diagnostics(
+          llvm::IntrusiveRefCntPtr<clang::DiagnosticIDs>(new clang::DiagnosticIDs()),
+          &*diagnosticOptions,
+          new clang::TextDiagnosticPrinter(errorStream, &*diagnosticOptions)
+        );
+
+        // Let the driver turn the GCC-style flags into a single frontend job
+        strVector args = { OCCA_CLANG_EXECUTABLE };
+        for (const std::string &flag : split(compilerFlags, ' ')) {
+          // Only an object is built, it's linked by ORC
+          if (flag.size() && (flag != "-shared")) {
+            args.push_back(flag);
+          }
+        }
+        args.push_back("-c");
+        args.push_back(sourceFilename);
+        args.push_back("-o");
+        args.push_back(objectFilename);
+
+        std::vector<const char*> argv;
+        for (const std::string &arg : args) {
+          argv.push_back(arg.c_str());
+        }
+
+        clang::driver::Driver driver(OCCA_CLANG_EXECUTABLE,
+                                     llvm::sys::getProcessTriple(),
+                                     diagnostics);
+        driver.setCheckInputsExist(false);
+
+        std::unique_ptr<clang::driver::Compilation> compilation(
+          driver.BuildCompilation(argv)
+        );
+        if (!compilation || diagnostics.hasErrorOccurred()) {
+          errorStream.flush();
+          return false;
+        }
+
+        const clang::driver::JobList &jobs = compilation->getJobs();
+        if ((jobs.size() != 1)
+            || !llvm::isa<clang::driver::Command>(*jobs.begin())) {
+          errorStream << "Compile flags don't map to a single frontend job\n";
+          errorStream.flush();
+          return false;
+        }
+        const clang::driver::Command &command = llvm::cast<clang::driver::Command>(*jobs.begin());
+        if (llvm::StringRef(command.getCreator().getName()) != "clang") {
+          errorStream << "Compile flags need an external tool\n";
+          errorStream.flush();
+          return false;
+        }
+
+        std::shared_ptr<clang::CompilerInvocation> invocation(new clang::CompilerInvocation());
+        if (!clang::CompilerInvocation::CreateFromArgs(*invocation,
+                                                       command.getArguments(),
+                                                       diagnostics)) {
+          errorStream.flush();
+          return false;
+        }
+
+        clang::CompilerInstance instance;
+        instance.setInvocation(invocation);
+        instance.createDiagnostics(
+          new clang::TextDiagnosticPrinter(errorStream, &instance.getDiagnosticOpts())
+        );
+
+        clang::EmitObjAction action;
+        const bool compiled = instance.ExecuteAction(action);
+
+        errorStream.flush();
+        return compiled;
+#else
+        errors = "OCCA was built without the Clang JIT";
+        return false;
+#endif
+      }
+
+      program* load(const std::string &objectFilename) {
+#if OCCA_CLANG_JIT_ENABLED
+        initializeTargets();
+
+        auto object = llvm::MemoryBuffer::getFile(objectFilename);
+        if (!object) {
+          return NULL;
+        }
+
+        auto session = llvm::orc::LLJITBuilder().create();
+        if (!session) {
+          llvm::consumeError(session.takeError());
+          return NULL;
+        }
+
+        // Kernels resolve libc, libm and libocca symbols from the process
+        auto processSymbols = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+          (*session)->getDataLayout().getGlobalPrefix()
+        );
+        if (!processSymbols) {
+          llvm::consumeError(processSymbols.takeError());
+          return NULL;
+        }
+        (*session)->getMainJITDylib().addGenerator(std::move(*processSymbols));
+
+        if (llvm::Error error = (*session)->addObjectFile(std::move(*object))) {
+          llvm::consumeError(std::move(error));
+          return NULL;
+        }
+
+#  if LLVM_VERSION_MAJOR >= 11
+        // Run static initializers (e.g. globals in the kernel source) before any lookup
+        if (llvm::Error error = (*session)->initialize((*session)->getMainJITDylib())) {
+          llvm::consumeError(std::move(error));
+          return NULL;
+        }
+#  endif
+
+        return new orcProgram(std::move(*session));
+#else
+        return NULL;
+#endif
+      }
+    }
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef OCCA_INTERNAL_MODES_SERIAL_JIT_HEADER
+#define OCCA_INTERNAL_MODES_SERIAL_JIT_HEADER
+
+#include <occa/defines.hpp>
+#include <occa/types.hpp>
+#include <occa/internal/utils/sys.hpp>
+
+namespace occa {
+  namespace serial {
+    // In-process compilation of host kernels through the Clang and LLVM ORC
+    //   libraries, skipping the compiler process and dlopen of the shell path.
+    // Only available when OCCA is configured with OCCA_ENABLE_CLANG_JIT
+    //   and the Clang libraries are found, otherwise nothing can be compiled.
+    namespace jit {
+      // Object code loaded into its own JIT session
+      class program {
+      public:
+        virtual ~program();
+
+        // Returns NULL if the symbol can't be found or linked
+        virtual functionPtr_t getFunction(const std::string &functionName) = 0;
+      };
+
+      bool isEnabled();
+
+      // Whether a compile with these settings can run in process
+      //   Compilers need to take GCC-style flags and nothing can be linked in
+      bool canCompile(const int compilerVendor,
+                      const std::string &compilerFlags,
+                      const std::string &compilerLinkerFlags);
+
+      // Compiles the source file into objectFilename
+      //   Returns false and fills in errors with the diagnostics on failure
+      bool compile(const std::string &sourceFilename,
+                   const std::string &compilerFlags,
+                   const std::string &objectFilename,
+                   std::string &errors);
+
+      // Returns NULL if the object couldn't be loaded
+      program* load(const std::string &objectFilename);
+    }
+  }
+}
+
+#endif
@@ -1,7 +1,13 @@
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
 #include <occa/core/base.hpp>
 #include <occa/internal/utils/env.hpp>
 #include <occa/internal/io.hpp>
+#include <occa/internal/modes/serial/device.hpp>
 #include <occa/internal/modes/serial/kernel.hpp>
+#include <occa/internal/modes/serial/stream.hpp>
 #include <occa/internal/lang/modes/serial.hpp>
 
 namespace occa {
@@ -11,14 +17,17 @@ namespace occa {
                    const std::string &sourceFilename_,
                    const occa::json &properties_) :
       occa::modeKernel_t(modeDevice_, name_, sourceFilename_, properties_),
-      dlHandle(NULL),
+      kernelModule(NULL),
       function(NULL),
       isLauncherKernel(false) {}
 
     kernel::~kernel() {
-      if (dlHandle) {
-        sys::dlclose(dlHandle);
-        dlHandle = NULL;
+      if (kernelModule) {
+        // Queued launches still call into the module
+        ((serial::device*) modeDevice)->waitForStreams();
+
+        ((serial::device*) modeDevice)->removeModuleRef(kernelModule);
+        kernelModule = NULL;
       }
     }
 
@@ -39,19 +48,73 @@ namespace occa {
     }
 
     void kernel::run() const {
-      const int args = (int) arguments.size();
-      if (!args) {
-        vArgs.resize(1);
-      } else if ((int) vArgs.size() < args) {
-        vArgs.resize(args);
+      runArguments(arguments);
+    }
+
+    void kernel::runWith(std::vector<kernelArgData> &args) {
+      runArguments(args);
+    }
+
+    bool kernel::isReentrant() const {
+      return true;
+    }
+
+    void kernel::runArguments(const std::vector<kernelArgData> &args) const {
+      stream &currentStream = ((device*) modeDevice)->getStream();
+      if (currentStream.isAsynchronous()) {
+        enqueueRun(currentStream, args);
+        return;
       }
 
-      // Set arguments
-      for (int i = 0; i < args; ++i) {
-        vArgs[i] = arguments[i].ptr();
+      // Argument pointers live on the stack so launches don't share state
+      //   and can run from several threads at once
+      const int argc = (int) args.size();
+      void *argPtrs[OCCA_MAX_ARGS];
+      for (int i = 0; i < argc; ++i) {
+        argPtrs[i] = args[i].ptr();
+      }
+
+      sys::runFunction(function, argc, argPtrs);
+    }
+
+    void kernel::enqueueRun(stream &currentStream,
+                            const std::vector<kernelArgData> &args) const {
+      const int argc = (int) args.size();
+
+      // Argument values can change or go out of scope before the launch runs,
+      //   so they're copied into storage owned by the queued work
+      static const size_t alignment = alignof(std::max_align_t);
+      size_t valueBytes = 0;
+      for (const kernelArgData &arg : args) {
+        if (!arg.isPointer()) {
+          valueBytes += alignment * ((arg.size() + alignment - 1) / alignment);
+        }
+      }
+
+      std::shared_ptr<std::vector<std::max_align_t>> values = std::make_shared<std::vector<std::max_align_t>>(
+        (valueBytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)
+      );
+      std::shared_ptr<std::vector<void*>> argPtrs = std::make_shared<std::vector<void*>>(
+        std::max(argc, 1)
+      );
+
+      char *valuePtr = (char*) values->data();
+      for (int i = 0; i < argc; ++i) {
+        const kernelArgData &arg = args[i];
+        if (arg.isPointer()) {
+          (*argPtrs)[i] = arg.ptr();
+          continue;
+        }
+        const size_t bytes = arg.size();
+        ::memcpy(valuePtr, arg.ptr(), bytes);
+        (*argPtrs)[i] = valuePtr;
+        valuePtr += alignment * ((bytes + alignment - 1) / alignment);
       }
 
-      sys::runFunction(function, args, &(vArgs[0]));
+      const functionPtr_t launchFunction = function;
+      currentStream.enqueue([launchFunction, argc, values, argPtrs]() {
+        sys::runFunction(launchFunction, argc, argPtrs->data());
+      });
     }
   }
 }
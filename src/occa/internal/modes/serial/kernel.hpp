@@ -5,18 +5,24 @@
 
 #include <occa/defines.hpp>
 #include <occa/internal/core/kernel.hpp>
+#include <occa/internal/modes/serial/module.hpp>
 #include <occa/internal/utils/sys.hpp>
 
 namespace occa {
   namespace serial {
     class device;
+    class stream;
 
     class kernel : public occa::modeKernel_t {
     protected:
-      void *dlHandle;
+      module *kernelModule;
       functionPtr_t function;
       mutable std::vector<void*> vArgs;
 
+      void enqueueRun(stream &currentStream,
+                      const std::vector<kernelArgData> &args) const;
+      void runArguments(const std::vector<kernelArgData> &args) const;
+
     public:
       bool isLauncherKernel;
 
@@ -34,6 +40,9 @@ namespace occa {
 
       void run() const override;
 
+      void runWith(std::vector<kernelArgData> &args) override;
+      bool isReentrant() const override;
+
       friend class device;
     };
   }
@@ -1,6 +1,8 @@
 #include <cstring>
 #include <occa/internal/modes/serial/buffer.hpp>
+#include <occa/internal/modes/serial/device.hpp>
 #include <occa/internal/modes/serial/memory.hpp>
+#include <occa/internal/modes/serial/stream.hpp>
 #include <occa/internal/utils/sys.hpp>
 #include <occa/internal/core/device.hpp>
 
@@ -20,6 +22,22 @@ namespace occa {
 
     memory::~memory() {}
 
+    void memory::copy(void *dest,
+                      const void *src,
+                      const udim_t bytes,
+                      const occa::json &props) const {
+      // Like CUDA, copies without {async: true} wait for queued work
+      if (!props.get("async", false)) {
+        getModeDevice()->finishAll();
+        ::memcpy(dest, src, bytes);
+        return;
+      }
+
+      ((device*) getModeDevice())->getStream().enqueue([=]() {
+        ::memcpy(dest, src, bytes);
+      });
+    }
+
     void* memory::getKernelArgPtr() const {
       return ptr;
     }
@@ -30,7 +48,7 @@ namespace occa {
                         const occa::json &props) const {
       const void *srcPtr = ptr + offset_;
 
-      ::memcpy(dest, srcPtr, bytes);
+      copy(dest, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const void *src,
@@ -41,7 +59,7 @@ namespace occa {
       void *destPtr      = ptr + offset_;
       const void *srcPtr = src;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      copy(destPtr, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const modeMemory_t *src,
@@ -53,7 +71,7 @@ namespace occa {
       void *destPtr      = ptr + destOffset;
       const void *srcPtr = src->ptr + srcOffset;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      copy(destPtr, srcPtr, bytes, props);
     }
 
     void* memory::unwrap() {
@@ -9,6 +9,13 @@
 namespace occa {
   namespace serial {
     class memory : public occa::modeMemory_t {
+    private:
+      // Copies on the current stream
+      void copy(void *dest,
+                const void *src,
+                const udim_t bytes,
+                const occa::json &props) const;
+
     public:
       memory(buffer *b,
              udim_t size_, dim_t offset_);
@@ -0,0 +1,51 @@
+#include <occa/internal/modes/serial/module.hpp>
+
+namespace occa {
+  namespace serial {
+    module::module(const std::string &binaryFilename_,
+                   const lang::sourceMetadata_t &metadata_,
+                   const bool isJitObject) :
+      binaryFilename(binaryFilename_),
+      dlHandle(NULL),
+      jitProgram(NULL),
+      metadata(metadata_),
+      refs(0) {
+      if (!isJitObject) {
+        dlHandle = sys::dlopen(binaryFilename);
+        return;
+      }
+
+      jitProgram = jit::load(binaryFilename);
+      OCCA_ERROR("Error loading JIT object [" << binaryFilename << "]",
+                 jitProgram);
+    }
+
+    module::~module() {
+      if (dlHandle) {
+        sys::dlclose(dlHandle);
+        dlHandle = NULL;
+      }
+      delete jitProgram;
+      jitProgram = NULL;
+    }
+
+    functionPtr_t module::getFunction(const std::string &kernelName) const {
+      if (!jitProgram) {
+        return sys::dlsym(dlHandle, kernelName);
+      }
+
+      functionPtr_t function = jitProgram->getFunction(kernelName);
+      OCCA_ERROR("Error loading symbol [" << kernelName << "] from JIT object [" << binaryFilename << "]",
+                 function);
+      return function;
+    }
+
+    lang::kernelMetadata_t module::getKernelMetadata(const std::string &kernelName) const {
+      lang::kernelMetadataMap::const_iterator it = metadata.kernelsMetadata.find(kernelName);
+      if (it != metadata.kernelsMetadata.end()) {
+        return it->second;
+      }
+      return lang::kernelMetadata_t();
+    }
+  }
+}
@@ -0,0 +1,33 @@
+#ifndef OCCA_INTERNAL_MODES_SERIAL_MODULE_HEADER
+#define OCCA_INTERNAL_MODES_SERIAL_MODULE_HEADER
+
+#include <occa/defines.hpp>
+#include <occa/internal/lang/kernelMetadata.hpp>
+#include <occa/internal/modes/serial/jit.hpp>
+#include <occa/internal/utils/sys.hpp>
+
+namespace occa {
+  namespace serial {
+    // A loaded binary holding every @kernel compiled from one source file.
+    // Kernels built from the same binary share its dl handle and build metadata.
+    // Objects compiled in process are loaded through their JIT program instead.
+    class module {
+    public:
+      std::string binaryFilename;
+      void *dlHandle;
+      jit::program *jitProgram;
+      lang::sourceMetadata_t metadata;
+      int refs;
+
+      module(const std::string &binaryFilename_,
+             const lang::sourceMetadata_t &metadata_,
+             const bool isJitObject = false);
+      ~module();
+
+      functionPtr_t getFunction(const std::string &kernelName) const;
+      lang::kernelMetadata_t getKernelMetadata(const std::string &kernelName) const;
+    };
+  }
+}
+
+#endif
@@ -4,10 +4,98 @@ namespace occa {
   namespace serial {
     stream::stream(modeDevice_t *modeDevice_,
                    const occa::json &properties_) :
-      modeStream_t(modeDevice_, properties_) {}
+      modeStream_t(modeDevice_, properties_),
+      isAsync(properties_.get("async", false)),
+      isRunningWork(false),
+      stopWorker(false) {
+      if (isAsync) {
+        worker = std::thread(&stream::runWorker, this);
+      }
+    }
+
+    stream::~stream() {
+      if (!isAsync) {
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopWorker = true;
+      }
+      queueChanged.notify_all();
+      worker.join();
+    }
+
+    bool stream::isAsynchronous() const {
+      return isAsync;
+    }
 
-    stream::~stream() {}
-    void stream::finish() {}
+    void stream::enqueue(std::function<void()> work) {
+      if (!isAsync) {
+        work();
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push_back(std::move(work));
+      }
+      queueChanged.notify_all();
+    }
+
+    void stream::wait() {
+      if (!isAsync) {
+        return;
+      }
+
+      std::unique_lock<std::mutex> lock(queueMutex);
+      queueChanged.wait(lock, [&]() {
+        return queue.empty() && !isRunningWork;
+      });
+    }
+
+    void stream::finish() {
+      wait();
+
+      std::exception_ptr error;
+      {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        std::swap(error, workError);
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+    void stream::runWorker() {
+      std::unique_lock<std::mutex> lock(queueMutex);
+      while (true) {
+        // Queued work is drained before stopping
+        queueChanged.wait(lock, [&]() {
+          return stopWorker || !queue.empty();
+        });
+        if (queue.empty()) {
+          return;
+        }
+
+        std::function<void()> work = std::move(queue.front());
+        queue.pop_front();
+        isRunningWork = true;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+          work();
+        } catch (...) {
+          error = std::current_exception();
+        }
+
+        lock.lock();
+        isRunningWork = false;
+        if (error && !workError) {
+          workError = error;
+        }
+        queueChanged.notify_all();
+      }
+    }
 
     void* stream::unwrap() {
       OCCA_FORCE_ERROR("stream::unwrap is not defined for serial mode");
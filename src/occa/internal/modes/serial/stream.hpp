@@ -1,20 +1,52 @@
 #ifndef OCCA_INTERNAL_MODES_SERIAL_STREAM_HEADER
 #define OCCA_INTERNAL_MODES_SERIAL_STREAM_HEADER
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include <occa/defines.hpp>
 #include <occa/internal/core/stream.hpp>
 
 namespace occa {
   namespace serial {
+    // Streams created with {async: true} run kernel launches and copies
+    //   in order on their own worker thread, otherwise work runs on the caller
     class stream : public occa::modeStream_t {
+    private:
+      bool isAsync;
+      std::thread worker;
+      std::mutex queueMutex;
+      std::condition_variable queueChanged;
+      std::deque<std::function<void()>> queue;
+      bool isRunningWork;
+      bool stopWorker;
+      std::exception_ptr workError;
+
     public:
       stream(modeDevice_t *modeDevice_,
              const occa::json &properties_);
 
       virtual ~stream();
+
+      bool isAsynchronous() const;
+
+      // Runs work after everything enqueued before it
+      void enqueue(std::function<void()> work);
+
+      // Waits for the queued work without reporting its errors
+      void wait();
+
+      // Waits for the queued work and rethrows the first error it raised
       void finish() override;
 
       void* unwrap() override;
+
+    private:
+      void runWorker();
     };
   }
 }
@@ -5,10 +5,14 @@
 namespace occa {
   namespace serial {
     streamTag::streamTag(modeDevice_t *modeDevice_,
-                         double time_) :
+                         std::shared_future<double> time_) :
       modeStreamTag_t(modeDevice_),
       time(time_) {}
 
+    double streamTag::getTime() const {
+      return time.get();
+    }
+
     void* streamTag::unwrap() {
       OCCA_FORCE_ERROR("streamTag::unwrap is not defined for serial mode");
       return nullptr;
@@ -3,19 +3,24 @@
 #ifndef OCCA_INTERNAL_MODES_SERIAL_STREAMTAG_HEADER
 #define OCCA_INTERNAL_MODES_SERIAL_STREAMTAG_HEADER
 
+#include <future>
+
 #include <occa/internal/core/streamTag.hpp>
 
 namespace occa {
   namespace serial {
     class streamTag : public occa::modeStreamTag_t {
     public:
-      double time;
+      // Set once the work queued before the tag has run
+      std::shared_future<double> time;
 
       streamTag(modeDevice_t *modeDevice_,
-                double time_);
+                std::shared_future<double> time_);
 
       virtual ~streamTag() = default;
 
+      double getTime() const;
+
       void* unwrap() override;
     };
   }
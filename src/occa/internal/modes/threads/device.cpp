@@ -0,0 +1,192 @@
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include <occa/internal/io.hpp>
+#include <occa/internal/lang/modes/threads.hpp>
+#include <occa/internal/modes/threads/device.hpp>
+#include <occa/internal/modes/threads/kernel.hpp>
+#include <occa/internal/utils/sys.hpp>
+
+namespace occa {
+  namespace threads {
+    namespace {
+      // Shared by the team during one kernel call
+      //   Threads that returned from the kernel leave the team so barriers
+      //   only wait for the threads still running it.
+      struct teamState_t {
+        int activeCount;
+        int waiting;
+        std::atomic<unsigned int> generation;
+        std::mutex barrierMutex;
+        std::mutex atomicMutex;
+        // Locals of the first thread being copied to the team
+        void **sharedValues;
+
+        teamState_t(const int threadCount_) :
+          activeCount(threadCount_),
+          waiting(0),
+          generation(0),
+          sharedValues(NULL) {}
+
+        // Expects barrierMutex to be locked
+        void releaseWaiting() {
+          waiting = 0;
+          generation.fetch_add(1, std::memory_order_release);
+        }
+      };
+
+      void teamBarrier(threadTeam_t *team) {
+        teamState_t &state = *((teamState_t*) team->data);
+
+        unsigned int generation;
+        {
+          std::lock_guard<std::mutex> guard(state.barrierMutex);
+          generation = state.generation.load(std::memory_order_relaxed);
+          if (++state.waiting == state.activeCount) {
+            state.releaseWaiting();
+            return;
+          }
+        }
+
+        while (state.generation.load(std::memory_order_acquire) == generation) {
+          std::this_thread::yield();
+        }
+      }
+
+      void teamLeave(threadTeam_t *team) {
+        teamState_t &state = *((teamState_t*) team->data);
+
+        std::lock_guard<std::mutex> guard(state.barrierMutex);
+        --state.activeCount;
+        if (state.waiting && (state.waiting == state.activeCount)) {
+          state.releaseWaiting();
+        }
+      }
+
+      void teamShare(threadTeam_t *team,
+                     void **values,
+                     const int *bytes,
+                     int count) {
+        teamState_t &state = *((teamState_t*) team->data);
+
+        if (team->thread == 0) {
+          state.sharedValues = values;
+        }
+        teamBarrier(team);
+
+        if (team->thread != 0) {
+          for (int i = 0; i < count; ++i) {
+            ::memcpy(values[i], state.sharedValues[i], bytes[i]);
+          }
+        }
+        // The first thread's locals stay unchanged until every thread copied them
+        teamBarrier(team);
+      }
+
+      void teamLock(threadTeam_t *team) {
+        ((teamState_t*) team->data)->atomicMutex.lock();
+      }
+
+      void teamUnlock(threadTeam_t *team) {
+        ((teamState_t*) team->data)->atomicMutex.unlock();
+      }
+    }
+
+    device::device(const occa::json &properties_) :
+      serial::device(properties_) {
+      threadCount = properties.get("threads", threadPool::defaultThreadCount());
+      OCCA_ERROR("[Threads] mode needs at least one thread (threads: " << threadCount << ")",
+                 threadCount > 0);
+
+      // Thread 0 is the calling thread
+      pool = new threadPool(threadCount + 1);
+
+      pinThreads();
+    }
+
+    device::~device() {
+      delete pool;
+    }
+
+    void device::pinThreads() {
+      std::vector<int> cores;
+      if (properties.has("cores")) {
+        for (const json &core : properties["cores"].array()) {
+          cores.push_back((int) core);
+        }
+      } else if (properties.get("pin_threads", false)) {
+        const int coreCount = sys::SystemInfo::load().processor.coreCount;
+        OCCA_ERROR("Unable to find the core count to pin threads",
+                   coreCount > 0);
+        for (int i = 0; i < threadCount; ++i) {
+          cores.push_back(i % coreCount);
+        }
+      }
+
+      if (!cores.size()) {
+        return;
+      }
+
+      pool->runOnEachThread([&](const int task, const int thread) {
+        if (thread) {
+          sys::pinToCore(cores[(thread - 1) % cores.size()]);
+        }
+      });
+    }
+
+    hash_t device::hash() const {
+      return (
+        serial::device::hash()
+        ^ occa::hash("threads device::hash")
+      );
+    }
+
+    hash_t device::kernelHash(const occa::json &props) const {
+      return (
+        serial::device::kernelHash(props)
+        ^ occa::hash("threads device::kernelHash")
+      );
+    }
+
+    lang::okl::serialParser* device::createParser(const occa::json &props) const {
+      return new lang::okl::threadsParser(props);
+    }
+
+    serial::kernel* device::newKernel(const std::string &kernelName,
+                                      const std::string &binaryFilename,
+                                      const occa::json &kernelProps) {
+      return new kernel(this,
+                        kernelName,
+                        binaryFilename,
+                        kernelProps);
+    }
+
+    int device::teamSize() const {
+      return threadCount;
+    }
+
+    void device::runTeam(const teamFunction_t &teamFunction) {
+      teamState_t state(threadCount);
+
+      pool->runOnEachThread([&](const int task, const int thread) {
+        if (!thread) {
+          return;
+        }
+
+        threadTeam_t team;
+        team.thread = thread - 1;
+        team.threadCount = threadCount;
+        team.barrier = teamBarrier;
+        team.leave = teamLeave;
+        team.lock = teamLock;
+        team.unlock = teamUnlock;
+        team.share = teamShare;
+        team.data = &state;
+
+        teamFunction(team);
+      });
+    }
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef OCCA_INTERNAL_MODES_THREADS_DEVICE_HEADER
+#define OCCA_INTERNAL_MODES_THREADS_DEVICE_HEADER
+
+#include <functional>
+
+#include <occa/internal/modes/serial/device.hpp>
+#include <occa/internal/utils/threadPool.hpp>
+
+namespace occa {
+  namespace threads {
+    // Passed to every kernel call, needs to match okl::threadsParser's occaThreadTeam_t
+    struct threadTeam_t {
+      int thread;
+      int threadCount;
+      void (*barrier)(threadTeam_t *team);
+      void (*leave)(threadTeam_t *team);
+      void (*lock)(threadTeam_t *team);
+      void (*unlock)(threadTeam_t *team);
+      void (*share)(threadTeam_t *team, void **values, const int *bytes, int count);
+      void *data;
+    };
+
+    typedef std::function<void(threadTeam_t &team)> teamFunction_t;
+
+    // Serial kernels where @outer iterations are split between worker threads
+    //   The calling thread only waits so each team member always runs on the
+    //   same (optionally pinned) worker.
+    class device : public serial::device {
+    private:
+      int threadCount;
+      threadPool *pool;
+
+    public:
+      device(const occa::json &properties_);
+      virtual ~device();
+
+      hash_t hash() const override;
+
+      hash_t kernelHash(const occa::json &props) const override;
+
+      lang::okl::serialParser* createParser(const occa::json &props) const override;
+
+      serial::kernel* newKernel(const std::string &kernelName,
+                                const std::string &binaryFilename,
+                                const occa::json &kernelProps) override;
+
+      int teamSize() const;
+
+      void runTeam(const teamFunction_t &teamFunction);
+
+    private:
+      void pinThreads();
+    };
+  }
+}
+
+#endif
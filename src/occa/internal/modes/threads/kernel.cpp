@@ -0,0 +1,44 @@
+#include <occa/internal/modes/threads/device.hpp>
+#include <occa/internal/modes/threads/kernel.hpp>
+
+namespace occa {
+  namespace threads {
+    kernel::kernel(modeDevice_t *modeDevice_,
+                   const std::string &name_,
+                   const std::string &sourceFilename_,
+                   const occa::json &properties_) :
+      serial::kernel(modeDevice_, name_, sourceFilename_, properties_) {}
+
+    void kernel::run() const {
+      device &teamDevice = *((device*) modeDevice);
+
+      // Teams run on the caller, after the work queued before them
+      teamDevice.finish();
+
+      const int args = (int) arguments.size();
+      vArgs.resize(args + 1);
+      for (int i = 0; i < args; ++i) {
+        vArgs[i] = arguments[i].ptr();
+      }
+
+      threadArgs.resize(teamDevice.teamSize());
+      for (std::vector<void*> &teamArgs : threadArgs) {
+        teamArgs = vArgs;
+      }
+
+      teamDevice.runTeam([&](threadTeam_t &team) {
+        std::vector<void*> &teamArgs = threadArgs[team.thread];
+        teamArgs[args] = &team;
+        sys::runFunction(function, args + 1, &(teamArgs[0]));
+      });
+    }
+
+    void kernel::runWith(std::vector<kernelArgData> &args) {
+      modeKernel_t::runWith(args);
+    }
+
+    bool kernel::isReentrant() const {
+      return false;
+    }
+  }
+}
@@ -0,0 +1,30 @@
+#ifndef OCCA_INTERNAL_MODES_THREADS_KERNEL_HEADER
+#define OCCA_INTERNAL_MODES_THREADS_KERNEL_HEADER
+
+#include <vector>
+
+#include <occa/internal/modes/serial/kernel.hpp>
+
+namespace occa {
+  namespace threads {
+    class kernel : public serial::kernel {
+    private:
+      // Arguments for each team member, which add their own team at the end
+      mutable std::vector<std::vector<void*>> threadArgs;
+
+    public:
+      kernel(modeDevice_t *modeDevice_,
+             const std::string &name_,
+             const std::string &sourceFilename_,
+             const occa::json &properties_);
+
+      void run() const override;
+
+      // Team members share the argument buffers, so launches are serialized
+      void runWith(std::vector<kernelArgData> &args) override;
+      bool isReentrant() const override;
+    };
+  }
+}
+
+#endif
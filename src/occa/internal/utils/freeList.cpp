@@ -0,0 +1,85 @@
+#include <occa/internal/utils/freeList.hpp>
+
+namespace occa {
+  freeList::freeList() :
+    freeBytes(0) {}
+
+  void freeList::clear() {
+    rangesByOffset.clear();
+    rangesBySize.clear();
+    freeBytes = 0;
+  }
+
+  bool freeList::reserve(const udim_t bytes, dim_t &offset) {
+    sizeSet::iterator it = rangesBySize.lower_bound(
+      std::make_pair(bytes, (dim_t) 0)
+    );
+    if (it == rangesBySize.end()) {
+      return false;
+    }
+
+    offset = it->second;
+    const udim_t rangeBytes = it->first;
+
+    removeRange(rangesByOffset.find(offset));
+    if (rangeBytes > bytes) {
+      addRange(offset + bytes, rangeBytes - bytes);
+    }
+    return true;
+  }
+
+  void freeList::release(const dim_t offset, const udim_t bytes) {
+    if (!bytes) {
+      return;
+    }
+
+    dim_t start = offset;
+    dim_t end = offset + bytes;
+
+    // Merge with the following range
+    offsetMap::iterator next = rangesByOffset.find(end);
+    if (next != rangesByOffset.end()) {
+      end += next->second;
+      removeRange(next);
+    }
+
+    // Merge with the preceding range
+    offsetMap::iterator prev = rangesByOffset.lower_bound(start);
+    if (prev != rangesByOffset.begin()) {
+      --prev;
+      if ((prev->first + (dim_t) prev->second) == start) {
+        start = prev->first;
+        removeRange(prev);
+      }
+    }
+
+    addRange(start, end - start);
+  }
+
+  udim_t freeList::bytes() const {
+    return freeBytes;
+  }
+
+  udim_t freeList::largestRange() const {
+    if (rangesBySize.empty()) {
+      return 0;
+    }
+    return rangesBySize.rbegin()->first;
+  }
+
+  int freeList::numRanges() const {
+    return (int) rangesByOffset.size();
+  }
+
+  void freeList::addRange(const dim_t offset, const udim_t bytes) {
+    rangesByOffset[offset] = bytes;
+    rangesBySize.insert(std::make_pair(bytes, offset));
+    freeBytes += bytes;
+  }
+
+  void freeList::removeRange(offsetMap::iterator it) {
+    rangesBySize.erase(std::make_pair(it->second, it->first));
+    freeBytes -= it->second;
+    rangesByOffset.erase(it);
+  }
+}
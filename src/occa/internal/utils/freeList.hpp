@@ -0,0 +1,42 @@
+#ifndef OCCA_INTERNAL_UTILS_FREELIST_HEADER
+#define OCCA_INTERNAL_UTILS_FREELIST_HEADER
+
+#include <map>
+#include <set>
+#include <utility>
+
+#include <occa/types.hpp>
+
+namespace occa {
+  // Free ranges of an address space, indexed by offset and by size
+  //   reserve() finds the smallest range that fits (best-fit) and release()
+  //   merges the range with its free neighbors, both in O(log n).
+  class freeList {
+  private:
+    typedef std::map<dim_t, udim_t> offsetMap;
+    typedef std::set<std::pair<udim_t, dim_t>> sizeSet;
+
+    offsetMap rangesByOffset;
+    sizeSet rangesBySize;
+    udim_t freeBytes;
+
+  public:
+    freeList();
+
+    void clear();
+
+    bool reserve(const udim_t bytes, dim_t &offset);
+
+    void release(const dim_t offset, const udim_t bytes);
+
+    udim_t bytes() const;
+    udim_t largestRange() const;
+    int numRanges() const;
+
+  private:
+    void addRange(const dim_t offset, const udim_t bytes);
+    void removeRange(offsetMap::iterator it);
+  };
+}
+
+#endif
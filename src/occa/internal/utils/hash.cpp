@@ -0,0 +1,127 @@
+#include <cstring>
+
+#include <occa/internal/utils/hash.hpp>
+
+namespace occa {
+  namespace {
+    const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    const uint64_t prime3 = 0x165667B19E3779F9ULL;
+    const uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    const uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+    inline uint64_t rotl(const uint64_t value, const int bits) {
+      return (value << bits) | (value >> (64 - bits));
+    }
+
+    inline uint64_t readLane(const unsigned char *ptr) {
+      uint64_t value;
+      ::memcpy(&value, ptr, sizeof(value));
+      return value;
+    }
+
+    inline uint64_t laneRound(uint64_t lane, const uint64_t input) {
+      lane += input * prime2;
+      lane = rotl(lane, 31);
+      return lane * prime1;
+    }
+
+    inline uint64_t avalanche(uint64_t value) {
+      value ^= value >> 33;
+      value *= prime2;
+      value ^= value >> 29;
+      value *= prime3;
+      value ^= value >> 32;
+      return value;
+    }
+  }
+
+  hasher_t::hasher_t() :
+    bufferBytes(0),
+    totalBytes(0) {
+    lanes[0] = prime1 + prime2;
+    lanes[1] = prime2;
+    lanes[2] = 0;
+    lanes[3] = 0 - prime1;
+  }
+
+  void hasher_t::consumeStripe(const unsigned char *stripe) {
+    for (int i = 0; i < laneCount; ++i) {
+      lanes[i] = laneRound(lanes[i], readLane(stripe + (i * sizeof(uint64_t))));
+    }
+  }
+
+  void hasher_t::update(const void *ptr, udim_t bytes) {
+    const unsigned char *c = (const unsigned char*) ptr;
+    totalBytes += bytes;
+
+    // Fill up a partial stripe first
+    if (bufferBytes) {
+      const udim_t missingBytes = stripeBytes - bufferBytes;
+      const udim_t copyBytes = (bytes < missingBytes) ? bytes : missingBytes;
+
+      ::memcpy(buffer + bufferBytes, c, copyBytes);
+      bufferBytes += (int) copyBytes;
+      c += copyBytes;
+      bytes -= copyBytes;
+
+      if (bufferBytes < stripeBytes) {
+        return;
+      }
+      consumeStripe(buffer);
+      bufferBytes = 0;
+    }
+
+    // Lanes are independent so the compiler is free to interleave or vectorize them
+    uint64_t l0 = lanes[0], l1 = lanes[1], l2 = lanes[2], l3 = lanes[3];
+    for (; bytes >= (udim_t) stripeBytes; bytes -= stripeBytes, c += stripeBytes) {
+      l0 = laneRound(l0, readLane(c));
+      l1 = laneRound(l1, readLane(c + 8));
+      l2 = laneRound(l2, readLane(c + 16));
+      l3 = laneRound(l3, readLane(c + 24));
+    }
+    lanes[0] = l0; lanes[1] = l1; lanes[2] = l2; lanes[3] = l3;
+
+    if (bytes) {
+      ::memcpy(buffer, c, bytes);
+      bufferBytes = (int) bytes;
+    }
+  }
+
+  hash_t hasher_t::digest() const {
+    uint64_t finalLanes[laneCount];
+    for (int i = 0; i < laneCount; ++i) {
+      finalLanes[i] = lanes[i];
+    }
+
+    // Zero-pad the trailing bytes, the total length disambiguates padding
+    if (bufferBytes) {
+      unsigned char stripe[stripeBytes];
+      ::memset(stripe, 0, stripeBytes);
+      ::memcpy(stripe, buffer, bufferBytes);
+      for (int i = 0; i < laneCount; ++i) {
+        finalLanes[i] = laneRound(finalLanes[i], readLane(stripe + (i * sizeof(uint64_t))));
+      }
+    }
+
+    const uint64_t merged = (
+      rotl(finalLanes[0], 1)
+      + rotl(finalLanes[1], 7)
+      + rotl(finalLanes[2], 12)
+      + rotl(finalLanes[3], 18)
+      + (totalBytes * prime5)
+    );
+
+    hash_t hash;
+    for (int i = 0; i < laneCount; ++i) {
+      const uint64_t word = avalanche(
+        finalLanes[i]
+        ^ (merged + ((uint64_t) (i + 1) * prime4))
+      );
+      ::memcpy(hash.h + (2 * i), &word, sizeof(word));
+    }
+    hash.initialized = true;
+
+    return hash;
+  }
+}
@@ -0,0 +1,36 @@
+#ifndef OCCA_INTERNAL_UTILS_HASH_HEADER
+#define OCCA_INTERNAL_UTILS_HASH_HEADER
+
+#include <stdint.h>
+
+#include <occa/utils/hash.hpp>
+
+namespace occa {
+  // Incremental 256-bit hash used by occa::hash
+  //   Input is consumed in 32-byte stripes by 4 independent 64-bit lanes
+  //   (xxHash64 rounds) which are mixed together into 4 output words.
+  //   Feeding the same bytes in any number of update() calls gives the same hash.
+  class hasher_t {
+  public:
+    static const int laneCount = 4;
+    static const int stripeBytes = laneCount * sizeof(uint64_t);
+
+  private:
+    uint64_t lanes[laneCount];
+    unsigned char buffer[stripeBytes];
+    int bufferBytes;
+    uint64_t totalBytes;
+
+  public:
+    hasher_t();
+
+    void update(const void *ptr, udim_t bytes);
+
+    hash_t digest() const;
+
+  private:
+    void consumeStripe(const unsigned char *stripe);
+  };
+}
+
+#endif
@@ -544,7 +544,9 @@ namespace occa {
 
     int SystemInfo::getCoreCount(const json &systemInfo) {
 #if   (OCCA_OS & OCCA_LINUX_OS)
-      return getSystemInfoField(systemInfo, "Model name");
+      return (int) parseInt(
+        (std::string) getSystemInfoField(systemInfo, "CPU(s)")
+      );
 #elif (OCCA_OS == OCCA_MACOS_OS)
       return getSystemInfoField(systemInfo, "hw.physicalcpu");
 #elif (OCCA_OS == OCCA_WINDOWS_OS)
@@ -875,6 +877,15 @@ namespace occa {
       return "";
     }
 
+    std::string compilerPrecompiledHeaderSuffix(const int vendor_) {
+      if (vendor_ & sys::vendor::GNU) {
+        return ".gch";
+      } else if (vendor_ & sys::vendor::LLVM) {
+        return ".pch";
+      }
+      return "";
+    }
+
     void addCompilerIncludeFlags(std::string &compilerFlags) {
       strVector includeDirs = env::OCCA_INCLUDE_PATH;
 
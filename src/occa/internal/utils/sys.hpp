@@ -142,6 +142,9 @@ namespace occa {
     std::string compilerSharedBinaryFlags(const std::string &compiler);
     std::string compilerSharedBinaryFlags(const int vendor_);
 
+    // Empty if the compiler doesn't pick up precompiled headers through -include
+    std::string compilerPrecompiledHeaderSuffix(const int vendor_);
+
     void addCompilerIncludeFlags(std::string &compilerFlags);
     void addCompilerLibraryFlags(std::string &compilerFlags);
 
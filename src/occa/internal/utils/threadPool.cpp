@@ -0,0 +1,153 @@
+#include <occa/internal/utils/threadPool.hpp>
+
+namespace occa {
+  threadPool::threadPool(const int threadCount) :
+    taskFunction(NULL),
+    taskCount(0),
+    nextTask(0),
+    taskPerThread(false),
+    activeWorkers(0),
+    jobId(0),
+    finished(false) {
+    // The calling thread acts as thread 0
+    for (int thread = 1; thread < threadCount; ++thread) {
+      threads.push_back(
+        std::thread(&threadPool::workerLoop, this, thread)
+      );
+    }
+  }
+
+  threadPool::~threadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished = true;
+    }
+    workerCondition.notify_all();
+
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+  }
+
+  int threadPool::size() const {
+    return (int) threads.size() + 1;
+  }
+
+  int threadPool::defaultThreadCount() {
+    const int threadCount = (int) std::thread::hardware_concurrency();
+    return (threadCount > 0) ? threadCount : 1;
+  }
+
+  void threadPool::run(const int taskCount_,
+                       const taskFunction_t &taskFunction_) {
+    runJob(taskCount_, false, taskFunction_);
+  }
+
+  void threadPool::runOnEachThread(const taskFunction_t &taskFunction_) {
+    runJob(size(), true, taskFunction_);
+  }
+
+  void threadPool::runJob(const int taskCount_,
+                          const bool taskPerThread_,
+                          const taskFunction_t &taskFunction_) {
+    if (taskCount_ <= 0) {
+      return;
+    }
+
+    if (!threads.size()) {
+      for (int task = 0; task < taskCount_; ++task) {
+        taskFunction_(task, 0);
+      }
+      return;
+    }
+
+    std::lock_guard<std::mutex> runLock(runMutex);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      taskFunction = &taskFunction_;
+      taskCount = taskCount_;
+      nextTask = 0;
+      taskPerThread = taskPerThread_;
+      activeWorkers = (int) threads.size();
+      taskException = NULL;
+      ++jobId;
+    }
+    workerCondition.notify_all();
+
+    runTasks(0);
+
+    std::exception_ptr exception;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      callerCondition.wait(lock, [&] { return activeWorkers == 0; });
+      taskFunction = NULL;
+      exception = taskException;
+      taskException = NULL;
+    }
+
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  void threadPool::workerLoop(const int thread) {
+    unsigned int lastJobId = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        workerCondition.wait(lock, [&] {
+          return finished || (jobId != lastJobId);
+        });
+        if (finished) {
+          return;
+        }
+        lastJobId = jobId;
+      }
+
+      runTasks(thread);
+
+      bool notifyCaller;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        notifyCaller = (--activeWorkers == 0);
+      }
+      if (notifyCaller) {
+        callerCondition.notify_one();
+      }
+    }
+  }
+
+  void threadPool::runTasks(const int thread) {
+    if (taskPerThread) {
+      try {
+        (*taskFunction)(thread, thread);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!taskException) {
+          taskException = std::current_exception();
+        }
+      }
+      return;
+    }
+
+    while (true) {
+      int task;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if ((nextTask >= taskCount) || taskException) {
+          return;
+        }
+        task = nextTask++;
+      }
+
+      try {
+        (*taskFunction)(task, thread);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!taskException) {
+          taskException = std::current_exception();
+        }
+      }
+    }
+  }
+}
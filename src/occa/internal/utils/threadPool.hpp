@@ -0,0 +1,63 @@
+#ifndef OCCA_INTERNAL_UTILS_THREADPOOL_HEADER
+#define OCCA_INTERNAL_UTILS_THREADPOOL_HEADER
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace occa {
+  // Fixed-size pool of worker threads
+  //   run() splits taskCount tasks among the workers and the calling thread
+  //   (thread 0) and blocks until they finish.
+  //   runOnEachThread() instead runs exactly one task per thread, with task == thread,
+  //   so work can be tied to a thread (for example a pinned core).
+  //   The first exception thrown by a task is re-thrown on the calling thread.
+  class threadPool {
+  public:
+    typedef std::function<void(const int task, const int thread)> taskFunction_t;
+
+  private:
+    std::vector<std::thread> threads;
+
+    std::mutex runMutex;
+    std::mutex mutex;
+    std::condition_variable workerCondition;
+    std::condition_variable callerCondition;
+
+    // Current job
+    const taskFunction_t *taskFunction;
+    int taskCount;
+    int nextTask;
+    bool taskPerThread;
+    int activeWorkers;
+    unsigned int jobId;
+    bool finished;
+    std::exception_ptr taskException;
+
+  public:
+    threadPool(const int threadCount);
+    ~threadPool();
+
+    int size() const;
+
+    void run(const int taskCount_,
+             const taskFunction_t &taskFunction_);
+
+    void runOnEachThread(const taskFunction_t &taskFunction_);
+
+    static int defaultThreadCount();
+
+  private:
+    void runJob(const int taskCount_,
+                const bool taskPerThread_,
+                const taskFunction_t &taskFunction_);
+
+    void workerLoop(const int thread);
+    void runTasks(const int thread);
+  };
+}
+
+#endif
@@ -3,41 +3,127 @@
 #include <occa/defines.hpp>
 #include <occa/internal/io.hpp>
 #include <occa/types/json.hpp>
+#include <occa/internal/utils/hash.hpp>
 #include <occa/internal/utils/lex.hpp>
 
 namespace occa {
   const char json::objectKeyEndChars[] = " \t\r\n\v\f:";
 
   json::json(const std::string &name,
-             const primitive &value) {
-    type = object_;
+             const primitive &value) :
+    type(none_) {
+    setType(object_);
     (*this)[name] = value;
   }
 
-  json::json(std::initializer_list<jsonKeyValue> entries) {
-    type = object_;
+  json::json(std::initializer_list<jsonKeyValue> entries) :
+    type(none_) {
+    setType(object_);
     for (auto &entry : entries) {
       (*this)[entry.name] = entry.value;
     }
   }
 
-  json::~json() {}
+  json::~json() {
+    destroyValue();
+  }
 
   json& json::clear() {
-    type = none_;
-    value_.string = "";
-    value_.number = 0;
-    value_.object.clear();
-    value_.array.clear();
+    destroyValue();
     return *this;
   }
 
   json& json::operator = (const json &j) {
-    type = j.type;
-    value_ = j.value_;
+    if (this == &j) {
+      return *this;
+    }
+    // Reuse the existing storage when possible
+    switch (type == j.type ? type : none_) {
+      case number_:
+        value_.number = j.value_.number;
+        break;
+      case string_:
+        value_.string = j.value_.string;
+        break;
+      default:
+        // j could be a child of this value
+        json copy(j);
+        destroyValue();
+        moveValue(copy);
+    }
     return *this;
   }
 
+  json& json::operator = (json &&j) {
+    if (this != &j) {
+      // j could be a child of this value
+      json moved(std::move(j));
+      destroyValue();
+      moveValue(moved);
+    }
+    return *this;
+  }
+
+  void json::copyValue(const json &j) {
+    switch (j.type) {
+      case number_:
+        new (&value_.number) primitive(j.value_.number);
+        break;
+      case string_:
+        new (&value_.string) std::string(j.value_.string);
+        break;
+      case array_:
+        new (&value_.array) jsonArray(j.value_.array);
+        break;
+      case object_:
+        new (&value_.object) jsonObject(j.value_.object);
+        break;
+      default:
+        break;
+    }
+    type = j.type;
+  }
+
+  void json::moveValue(json &j) {
+    switch (j.type) {
+      case number_:
+        new (&value_.number) primitive(j.value_.number);
+        break;
+      case string_:
+        new (&value_.string) std::string(std::move(j.value_.string));
+        break;
+      case array_:
+        new (&value_.array) jsonArray(std::move(j.value_.array));
+        break;
+      case object_:
+        new (&value_.object) jsonObject(std::move(j.value_.object));
+        break;
+      default:
+        break;
+    }
+    type = j.type;
+    j.destroyValue();
+  }
+
+  json& json::mismatchedValue(const type_t type_) {
+    // Mutable access converts the value to the type being accessed
+    //   so writes through the returned reference are kept
+    return setType(type_);
+  }
+
+  const json& json::emptyValue(const type_t type_) {
+    static const json emptyNumber(number_);
+    static const json emptyString(string_);
+    static const json emptyArray(array_);
+    static const json emptyObject(object_);
+    switch (type_) {
+      case number_: return emptyNumber;
+      case string_: return emptyString;
+      case array_:  return emptyArray;
+      default:      return emptyObject;
+    }
+  }
+
   bool json::isInitialized() const {
     return (type != none_);
   }
@@ -212,7 +298,7 @@ namespace occa {
     // Skip quote
     const char quote = *c;
     ++c;
-    type = string_;
+    setType(string_);
 
     while (*c != '\0') {
       if (*c == '\\') {
@@ -260,7 +346,7 @@ namespace occa {
   }
 
   void json::loadNumber(const char *&c) {
-    type = number_;
+    setType(number_);
     value_.number = primitive::load(c);
   }
 
@@ -270,7 +356,7 @@ namespace occa {
     if (hasBrace) {
       ++c;
     }
-    type = object_;
+    setType(object_);
 
     while (*c != '\0') {
       lex::skipWhitespace(c);
@@ -328,7 +414,7 @@ namespace occa {
   void json::loadArray(const char *&c) {
     // Skip [
     ++c;
-    type = array_;
+    setType(array_);
 
     while (*c != '\0') {
       lex::skipWhitespace(c);
@@ -360,7 +446,7 @@ namespace occa {
     OCCA_ERROR("Cannot read value: " << c,
                !strncmp(c, "true", 4));
     c += 4;
-    type = number_;
+    setType(number_);
     value_.number = true;
   }
 
@@ -368,7 +454,7 @@ namespace occa {
     OCCA_ERROR("Cannot read value: " << c,
                !strncmp(c, "false", 5));
     c += 5;
-    type = number_;
+    setType(number_);
     value_.number = false;
   }
 
@@ -376,7 +462,7 @@ namespace occa {
     OCCA_ERROR("Cannot read value: " << c,
                !strncmp(c, "null", 4));
     c += 4;
-    type = null_;
+    setType(null_);
   }
 
   void json::loadComment(const char *&c) {
@@ -399,7 +485,7 @@ namespace occa {
 
     // We're not defined, treat this as an = operator
     if (type == none_) {
-      type = j.type;
+      setType(j.type);
     }
     OCCA_ERROR("Cannot apply operator + with different JSON types",
                (type == array_) ||
@@ -428,23 +514,21 @@ namespace occa {
   }
 
   void json::mergeWithObject(const jsonObject &obj) {
-    jsonObject::const_iterator it = obj.begin();
-    while (it != obj.end()) {
-      const std::string &key = it->first;
-      const json &val = it->second;
-      ++it;
+    jsonObject &object = value_.object;
+    for (const auto &entry : obj) {
+      jsonObject::iterator it = object.find(entry.first);
+      if (it == object.end()) {
+        object.insert(entry);
+        continue;
+      }
 
       // If we're merging two json objects, recursively merge them
-      if (val.isObject() && has(key)) {
-        // Reuse prefetch
-        json &oldVal = value_.object[key];
-        if (oldVal.isObject()) {
-          oldVal += val;
-        } else {
-          oldVal = val;
-        }
+      json &oldVal = it->second;
+      const json &val = entry.second;
+      if (val.isObject() && oldVal.isObject()) {
+        oldVal += val;
       } else {
-        value_.object[key] = val;
+        oldVal = val;
       }
     }
   }
@@ -461,12 +545,12 @@ namespace occa {
       const char *cStart = c;
       lex::skipTo(c, '/', '\\');
 
-      std::string key(cStart, c - cStart);
+      const size_t keyLength = c - cStart;
       if (*c == '/') {
         ++c;
       }
 
-      jsonObject::const_iterator it = j->value_.object.find(key);
+      jsonObject::const_iterator it = j->value_.object.find(std::string(cStart, keyLength));
       if (it == j->value_.object.end()) {
         return false;
       }
@@ -483,7 +567,7 @@ namespace occa {
     bool exists = true;
 
     if (type == none_) {
-      type = object_;
+      setType(object_);
       exists = false;
     }
 
@@ -493,19 +577,19 @@ namespace occa {
 
       const char *cStart = c;
       lex::skipTo(c, '/', '\\');
-      std::string key(cStart, c - cStart);
+      const size_t keyLength = c - cStart;
       if (*c == '/') {
         ++c;
       }
 
-      j = &(j->value_.object[key]);
+      j = &(j->value_.object[std::string(cStart, keyLength)]);
       if (j->type == none_) {
-        j->type = object_;
+        j->setType(object_);
         exists = false;
       }
     }
     if (!exists) {
-      j->type = none_;
+      j->clear();
     }
     return *j;
   }
@@ -520,12 +604,12 @@ namespace occa {
 
       const char *cStart = c;
       lex::skipTo(c, '/', '\\');
-      std::string key(cStart, c - cStart);
+      const size_t keyLength = c - cStart;
       if (*c == '/') {
         ++c;
       }
 
-      jsonObject::const_iterator it = j->value_.object.find(key);
+      jsonObject::const_iterator it = j->value_.object.find(std::string(cStart, keyLength));
       if (it == j->value_.object.end()) {
         return default_;
       }
@@ -577,28 +661,33 @@ namespace occa {
   }
 
   json json::getPathValue(const char *key) const {
+    const json *j = findPath(key);
+    return j ? *j : json();
+  }
+
+  const json* json::findPath(const char *key) const {
     const json *j = this;
     const char *c = key;
 
     while (*c != '\0') {
       if (j->type != object_) {
-        return json();
+        return NULL;
       }
 
       const char *cStart = c;
       lex::skipTo(c, '/');
-      std::string nextKey(cStart, c - cStart);
+      const size_t keyLength = c - cStart;
       if (*c == '/') {
         ++c;
       }
 
-      jsonObject::const_iterator it = j->value_.object.find(nextKey);
+      jsonObject::const_iterator it = j->value_.object.find(std::string(cStart, keyLength));
       if (it == j->value_.object.end()) {
-        return json();
+        return NULL;
       }
       j = &(it->second);
     }
-    return *j;
+    return j;
   }
 
   json& json::remove(const char *c) {
@@ -610,17 +699,20 @@ namespace occa {
 
       const char *cStart = c;
       lex::skipTo(c, '/', '\\');
-      std::string key(cStart, c - cStart);
+      const size_t keyLength = c - cStart;
       if (*c == '/') {
         ++c;
       }
 
       if (*c == '\0') {
-        j->value_.object.erase(key);
+        jsonObject::iterator it = j->value_.object.find(std::string(cStart, keyLength));
+        if (it != j->value_.object.end()) {
+          j->value_.object.erase(it);
+        }
         return *this;
       }
 
-      jsonObject::iterator it = j->value_.object.find(key);
+      jsonObject::iterator it = j->value_.object.find(std::string(cStart, keyLength));
       if (it == j->value_.object.end()) {
         return *this;
       }
@@ -629,10 +721,82 @@ namespace occa {
     return *this;
   }
 
+  namespace {
+    template <class T>
+    inline void hashValue(hasher_t &hasher, const T &value) {
+      hasher.update(&value, sizeof(T));
+    }
+
+    inline void hashString(hasher_t &hasher, const std::string &str) {
+      hashValue(hasher, (uint64_t) str.size());
+      hasher.update(str.c_str(), str.size());
+    }
+
+    // Each value is prefixed with its type and containers with their size,
+    //   so different trees can't feed the same byte stream
+    void hashJson(hasher_t &hasher, const json &j) {
+      switch (j.type) {
+        case json::none_: {
+          // Unset properties hash like empty ones
+          hashValue(hasher, '{');
+          hashValue(hasher, (uint64_t) 0);
+          break;
+        }
+        case json::null_: {
+          hashValue(hasher, 'n');
+          break;
+        }
+        case json::number_: {
+          // Integers of different types but with the same value hash the same
+          const primitive &number = j.value_.number;
+          if (number.isBool()) {
+            hashValue(hasher, 'b');
+            hashValue(hasher, (char) number.value.bool_);
+          } else if (number.isFloat()) {
+            hashValue(hasher, 'f');
+            hashValue(hasher, (double) number);
+          } else if (number.isSigned() && ((int64_t) number < 0)) {
+            hashValue(hasher, 'i');
+            hashValue(hasher, (int64_t) number);
+          } else if (number.isInteger()) {
+            hashValue(hasher, 'u');
+            hashValue(hasher, (uint64_t) number);
+          } else {
+            hashValue(hasher, 'p');
+            hashValue(hasher, (uint64_t) number.value.ptr);
+          }
+          break;
+        }
+        case json::string_: {
+          hashValue(hasher, 's');
+          hashString(hasher, j.value_.string);
+          break;
+        }
+        case json::array_: {
+          hashValue(hasher, '[');
+          hashValue(hasher, (uint64_t) j.value_.array.size());
+          for (const json &entry : j.value_.array) {
+            hashJson(hasher, entry);
+          }
+          break;
+        }
+        case json::object_: {
+          hashValue(hasher, '{');
+          hashValue(hasher, (uint64_t) j.value_.object.size());
+          for (const auto &entry : j.value_.object) {
+            hashString(hasher, entry.first);
+            hashJson(hasher, entry.second);
+          }
+          break;
+        }
+      }
+    }
+  }
+
   hash_t json::hash() const {
-    std::string out;
-    dumpToString(out);
-    return occa::hash(out);
+    hasher_t hasher;
+    hashJson(hasher, *this);
+    return hasher.digest();
   }
 
   std::string json::toString() const {
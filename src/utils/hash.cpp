@@ -5,6 +5,7 @@
 #include <occa/types.hpp>
 #include <occa/utils/hash.hpp>
 #include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/hash.hpp>
 #include <occa/internal/io.hpp>
 
 namespace occa {
@@ -146,25 +147,9 @@ namespace occa {
   }
 
   hash_t hash(const void *ptr, udim_t bytes) {
-    std::stringstream ss;
-    const char *c = (char*) ptr;
-
-    hash_t hash;
-    int *h = hash.h;
-
-    const int p[8] = {
-      102679, 102701, 102761, 102763,
-      102769, 102793, 102797, 102811
-    };
-
-    for (udim_t i = 0; i < bytes; ++i) {
-      for (int j = 0; j < 8; ++j) {
-        h[j] = (h[j] * p[j]) ^ c[i];
-      }
-    }
-    hash.initialized = true;
-
-    return hash;
+    hasher_t hasher;
+    hasher.update(ptr, bytes);
+    return hasher.digest();
   }
 
   hash_t hash(const char *c) {
@@ -176,9 +161,8 @@ namespace occa {
   }
 
   hash_t hashFile(const std::string &filename) {
-    const char *c = io::c_read(io::expandFilename(filename));
-    hash_t ret = hash(c);
-    delete [] c;
-    return ret;
+    return io::fileHashCache_t::getInstance().hashFile(
+      io::expandFilename(filename)
+    );
   }
 }
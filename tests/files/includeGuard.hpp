@@ -0,0 +1,5 @@
+// Comments outside of the guard are dropped on later includes
+#ifndef OCCA_TEST_INCLUDE_GUARD
+#define OCCA_TEST_INCLUDE_GUARD
+1 2
+#endif
@@ -0,0 +1,2 @@
+#pragma once
+3 4
@@ -175,6 +175,30 @@ void testRun() {
 
   occaKernelRunWithArgs(argKernel, 14, args);
 
+  // Bound launches
+  occaBoundKernel boundArgKernel = occaCreateBoundKernel(argKernel);
+  ASSERT_EQ(occaBoundKernelArgumentIndex(boundArgKernel, "mem"), 1);
+  ASSERT_EQ(occaBoundKernelArgumentIndex(boundArgKernel, "missing"), -1);
+
+  occaBoundKernelBindArgs(boundArgKernel, 14, args);
+  occaBoundKernelLaunch(boundArgKernel);
+
+  occaBoundKernelBindArg(boundArgKernel, 6, occaInt32(7));
+  occaBoundKernelBindNamedArg(boundArgKernel, "i8", occaInt8(3));
+  occaBoundKernelLaunch(boundArgKernel);
+
+  ASSERT_THROW(
+    occaBoundKernelBindArg(boundArgKernel, 14, occaInt32(7));
+  );
+  ASSERT_THROW(
+    occaBoundKernelBindNamedArg(boundArgKernel, "missing", occaInt32(7));
+  );
+  ASSERT_THROW(
+    occaBoundKernelLaunch(argKernel);
+  );
+
+  occaFree(&boundArgKernel);
+
   // Bad argument types
   ASSERT_THROW(
     occaKernelRunN(argKernel, 1, occaGetDevice());
@@ -0,0 +1,161 @@
+#include <occa.hpp>
+
+#include <occa/internal/utils/testing.hpp>
+
+occa::kernel addVectors;
+const std::string addVectorsSource = (
+  "@kernel void addVectors(const int entries,\n"
+  "                        const float *a,\n"
+  "                        const float *b,\n"
+  "                        float *ab) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    ab[i] = a[i] + b[i];\n"
+  "  }\n"
+  "}\n"
+);
+
+void testInit();
+void testBind();
+void testLaunch();
+void testMemoryRefs();
+
+int main(const int argc, const char **argv) {
+  addVectors = occa::buildKernelFromString(addVectorsSource,
+                                           "addVectors");
+
+  testInit();
+  testBind();
+  testLaunch();
+  testMemoryRefs();
+
+  return 0;
+}
+
+void testInit() {
+  occa::boundKernel launch;
+  ASSERT_FALSE(launch.isInitialized());
+  ASSERT_THROW(
+    launch.launch();
+  );
+
+  launch = occa::boundKernel(addVectors);
+  ASSERT_TRUE(launch.isInitialized());
+  ASSERT_TRUE(launch.getKernel() == addVectors);
+
+  ASSERT_EQ(launch.argumentCount(), 4);
+  ASSERT_EQ(launch.argumentIndex("entries"), 0);
+  ASSERT_EQ(launch.argumentIndex("a"), 1);
+  ASSERT_EQ(launch.argumentIndex("ab"), 3);
+  ASSERT_EQ(launch.argumentIndex("c"), -1);
+}
+
+void testBind() {
+  occa::boundKernel launch(addVectors);
+  occa::memory a = occa::malloc<float>(10);
+
+  // Out of bounds and unknown arguments
+  ASSERT_THROW(
+    launch.bind(-1, 10);
+  );
+  ASSERT_THROW(
+    launch.bind(4, 10);
+  );
+  ASSERT_THROW(
+    launch.bind("c", 10);
+  );
+
+  // Arguments are validated when they're bound
+  ASSERT_THROW(
+    launch.bind("entries", a);
+  );
+  ASSERT_THROW(
+    launch.bind("a", 10);
+  );
+  ASSERT_THROW(
+    launch.bind("a", occa::malloc<char>(10));
+  );
+
+  // Everything needs to be bound before launching
+  launch.bind("entries", 10);
+  launch.bind("a", a);
+  ASSERT_THROW(
+    launch.launch();
+  );
+}
+
+void testLaunch() {
+  const int entries = 10;
+
+  float a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = i;
+    b[i] = 1 - i;
+    ab[i] = 0;
+  }
+
+  occa::memory o_a = occa::malloc<float>(entries, a);
+  occa::memory o_b = occa::malloc<float>(entries, b);
+  occa::memory o_ab = occa::malloc<float>(entries, ab);
+
+  occa::boundKernel launch(addVectors);
+  launch.bind(1, o_a);
+  launch.bind(2, o_b);
+  launch.bind("ab", o_ab);
+
+  // Update a scalar between launches
+  for (int count = 1; count <= entries; ++count) {
+    launch.bind("entries", count);
+    launch.launch();
+
+    o_ab.copyTo(ab);
+    for (int i = 0; i < entries; ++i) {
+      ASSERT_EQ(ab[i], (float) (i < count ? 1 : 0));
+    }
+  }
+
+  // The kernel's own arguments are left alone
+  addVectors.clearArgs();
+  ASSERT_THROW(
+    addVectors.run();
+  );
+}
+
+void testMemoryRefs() {
+  const int entries = 10;
+  occa::device device = occa::getDevice();
+
+  float a[entries], b[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i] = i;
+    b[i] = 1 - i;
+  }
+
+  occa::memory o_ab = device.malloc<float>(entries);
+  occa::boundKernel launch(addVectors);
+  launch.bind("entries", entries);
+  launch.bind("ab", o_ab);
+
+  const occa::udim_t bytesAllocated = device.memoryAllocated();
+  {
+    // Wrappers go out of scope before launching
+    occa::memory o_a = device.malloc<float>(entries, a);
+    occa::memory o_b = device.malloc<float>(entries, b);
+    launch.bind("a", o_a);
+    launch.bind("b", o_b);
+  }
+  ASSERT_EQ(bytesAllocated + (2 * entries * sizeof(float)),
+            device.memoryAllocated());
+
+  launch.launch();
+
+  float ab[entries];
+  o_ab.copyTo(ab);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 1.0f);
+  }
+
+  // Rebinding releases the previous memory
+  launch.bind("a", o_ab);
+  launch.bind("b", o_ab);
+  ASSERT_EQ(bytesAllocated, device.memoryAllocated());
+}
@@ -1,14 +1,23 @@
 #include <occa.hpp>
+#include <occa/internal/io.hpp>
+#include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/sys.hpp>
 #include <occa/internal/utils/testing.hpp>
 
 void testProperties();
 void testWrapMemory();
 void testUnwrap();
+void testKernelCache();
+void testBuildKernels();
+void testResolvedProperties();
 
 int main(const int argc, const char **argv) {
   testProperties();
   testWrapMemory();
   testUnwrap();
+  testKernelCache();
+  testBuildKernels();
+  testResolvedProperties();
 
   return 0;
 }
@@ -136,3 +145,217 @@ void testUnwrap() {
   // Unwrapping a serial mode device is undefined
   ASSERT_THROW(occa::unwrap(device););
 }
+
+void testKernelCache() {
+  const std::string addVectorsFile = (
+    occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+  );
+
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  occa::kernel addVectors = device.buildKernel(addVectorsFile,
+                                               "addVectors");
+  ASSERT_EQ(device.kernelCacheHits(), (occa::udim_t) 0);
+  ASSERT_EQ(device.kernelCacheMisses(), (occa::udim_t) 1);
+
+  occa::kernel addVectors2 = device.buildKernel(addVectorsFile,
+                                                "addVectors");
+  ASSERT_TRUE(addVectors == addVectors2);
+  ASSERT_EQ(device.kernelCacheHits(), (occa::udim_t) 1);
+  ASSERT_EQ(device.kernelCacheMisses(), (occa::udim_t) 1);
+
+  // Different properties build a different kernel
+  occa::kernel addVectors3 = device.buildKernel(addVectorsFile,
+                                                "addVectors",
+                                                {{"defines/FOO", 1}});
+  ASSERT_TRUE(addVectors != addVectors3);
+  ASSERT_EQ(device.kernelCacheMisses(), (occa::udim_t) 2);
+
+  // The cache doesn't keep kernels alive
+  addVectors = occa::kernel();
+  addVectors2 = occa::kernel();
+  addVectors = device.buildKernel(addVectorsFile,
+                                  "addVectors");
+  ASSERT_TRUE(addVectors.isInitialized());
+  ASSERT_EQ(device.kernelCacheHits(), (occa::udim_t) 1);
+  ASSERT_EQ(device.kernelCacheMisses(), (occa::udim_t) 3);
+
+  // Freed kernels are removed from the cache
+  addVectors.free();
+  ASSERT_FALSE(addVectors.isInitialized());
+  addVectors = device.buildKernel(addVectorsFile,
+                                  "addVectors");
+  ASSERT_TRUE(addVectors.isInitialized());
+  ASSERT_EQ(device.kernelCacheMisses(), (occa::udim_t) 4);
+
+  // Edited headers don't return the cached kernel
+  const std::string testDir = occa::env::OCCA_CACHE_DIR + "kernel_cache_test/";
+  const std::string headerFile = testDir + "value.hpp";
+  occa::sys::rmrf(testDir);
+  occa::sys::mkpath(testDir);
+
+  const std::string setValueSource = (
+    "#include \"" + headerFile + "\"\n"
+    "@kernel void setValue(int *value) {\n"
+    "  for (int i = 0; i < 1; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {\n"
+    "      value[0] = VALUE;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+
+  occa::memory value = device.malloc<int>(1);
+  int hostValue = 0;
+
+  occa::io::write(headerFile, "#define VALUE 1\n");
+  occa::kernel setValue = device.buildKernelFromString(setValueSource, "setValue");
+  setValue(value);
+  value.copyTo(&hostValue);
+  ASSERT_EQ(1, hostValue);
+
+  // Cache hits don't touch the filesystem, edited headers are found
+  //   once the cached kernel is released
+  occa::io::write(headerFile, "#define VALUE 22\n");
+  occa::kernel setValue2 = device.buildKernelFromString(setValueSource, "setValue");
+  ASSERT_TRUE(setValue == setValue2);
+
+  setValue = occa::kernel();
+  setValue2 = occa::kernel();
+  setValue2 = device.buildKernelFromString(setValueSource, "setValue");
+  ASSERT_TRUE(setValue2.isInitialized());
+  setValue2(value);
+  value.copyTo(&hostValue);
+  ASSERT_EQ(22, hostValue);
+
+  occa::sys::rmrf(testDir);
+
+  device.free();
+  ASSERT_FALSE(addVectors.isInitialized());
+  ASSERT_FALSE(addVectors3.isInitialized());
+}
+
+void testBuildKernels() {
+  const std::string addVectorsFile = (
+    occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+  );
+  const std::string argKernelFile = (
+    occa::env::OCCA_DIR + "tests/files/argKernel.okl"
+  );
+
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  occa::kernelVector kernels = device.buildKernels(
+    {
+      {addVectorsFile, "addVectors", {}},
+      {argKernelFile, "argKernel", {{"serial/include_std", true}}},
+      {addVectorsFile, "addVectors", {}},
+      {addVectorsFile, "addVectors", {{"defines/FOO", 2}}}
+    },
+    {{"threads", 4}}
+  );
+
+  ASSERT_EQ((int) kernels.size(), 4);
+  for (occa::kernel &kernel : kernels) {
+    ASSERT_TRUE(kernel.isInitialized());
+  }
+  ASSERT_EQ(kernels[0].name(), "addVectors");
+  ASSERT_EQ(kernels[1].name(), "argKernel");
+
+  // Duplicate builds share the same kernel
+  ASSERT_TRUE(kernels[0] == kernels[2]);
+  ASSERT_TRUE(kernels[0] != kernels[3]);
+  ASSERT_EQ(device.kernelCacheMisses(), (occa::udim_t) 3);
+
+  ASSERT_EQ((int) device.buildKernels({}).size(), 0);
+
+  // Build errors are forwarded to the caller
+  ASSERT_THROW(
+    device.buildKernels({
+      {addVectorsFile, "addVectors", {}},
+      {addVectorsFile, "addVectors", {{"defines/FOO", 3}, {"compiler_flags", "--bad-flag"}}}
+    });
+  );
+}
+
+void testResolvedProperties() {
+  const std::string addVectorsFile = (
+    occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+  );
+
+  occa::device device({
+    {"mode", "Serial"},
+    {"memory", {
+      {"one", 1}
+    }}
+  });
+
+  occa::resolvedProperties memProps = device.resolveMemoryProperties({
+    {"two", 2},
+    {"modes/Serial/three", 3}
+  });
+  ASSERT_TRUE(memProps.isInitialized());
+  ASSERT_EQ(1, memProps.properties().get<int>("one"));
+  ASSERT_EQ(2, memProps.properties().get<int>("two"));
+  ASSERT_EQ(3, memProps.properties().get<int>("three"));
+  ASSERT_FALSE(memProps.properties().has("modes"));
+  ASSERT_TRUE(memProps.hash() == occa::hash(device.memoryProperties({{"two", 2}, {"three", 3}})));
+
+  float values[4] = {1, 2, 3, 4};
+  occa::memory mem = device.malloc<float>(4, values, memProps);
+  ASSERT_EQ((occa::udim_t) 4, mem.size());
+  ASSERT_EQ(2, mem.properties().get<int>("two"));
+
+  float copiedValues[4];
+  mem.copyTo(copiedValues);
+  ASSERT_EQ(3.0f, copiedValues[2]);
+
+  mem = device.malloc(8, occa::dtype::byte, memProps);
+  ASSERT_EQ((occa::udim_t) 8, mem.size());
+
+  // Resolved kernel properties build the same kernel
+  occa::resolvedProperties kernelProps = device.resolveKernelProperties({
+    {"defines/FOO", 4}
+  });
+  occa::kernel addVectors = device.buildKernel(addVectorsFile,
+                                               "addVectors",
+                                               {{"defines/FOO", 4}});
+  const occa::udim_t cacheHits = device.kernelCacheHits();
+  ASSERT_TRUE(addVectors == device.buildKernel(addVectorsFile,
+                                               "addVectors",
+                                               kernelProps));
+  ASSERT_EQ(cacheHits + 1, device.kernelCacheHits());
+
+  occa::stream stream = device.createStream(
+    device.resolveStreamProperties()
+  );
+  ASSERT_TRUE(stream.isInitialized());
+
+  // Properties only work with the device and call they were resolved for
+  occa::device otherDevice({
+    {"mode", "Serial"}
+  });
+  ASSERT_THROW(
+    otherDevice.malloc<float>(4, memProps);
+  );
+  ASSERT_THROW(
+    device.malloc<float>(4, kernelProps);
+  );
+  occa::resolvedProperties movedProps = std::move(kernelProps);
+  ASSERT_FALSE(kernelProps.isInitialized());
+  ASSERT_THROW(
+    device.malloc<float>(4, kernelProps);
+  );
+
+  // Empty braces still pick the json overloads
+  mem = device.malloc<float>(4, values, {});
+  ASSERT_EQ((occa::udim_t) 4, mem.size());
+  ASSERT_TRUE(addVectors == device.buildKernel(addVectorsFile,
+                                               "addVectors",
+                                               {{"defines/FOO", 4}}));
+  ASSERT_TRUE(device.buildKernel(addVectorsFile, "addVectors", {}).isInitialized());
+}
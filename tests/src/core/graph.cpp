@@ -0,0 +1,237 @@
+#include <occa.hpp>
+
+#include <occa/internal/utils/testing.hpp>
+
+const std::string kernelSource = (
+  "@kernel void addOne(const int entries,\n"
+  "                    float *x) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    x[i] += 1;\n"
+  "  }\n"
+  "}\n"
+  "\n"
+  "@kernel void axpy(const int entries,\n"
+  "                  const float alpha,\n"
+  "                  const float *x,\n"
+  "                  float *y) {\n"
+  "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+  "    y[i] += alpha * x[i];\n"
+  "  }\n"
+  "}\n"
+);
+
+void testCapture();
+void testReplay();
+void testDependencies();
+void testTags();
+
+int main(const int argc, const char **argv) {
+  testCapture();
+  testReplay();
+  testDependencies();
+  testTags();
+
+  return 0;
+}
+
+void testCapture() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  ASSERT_FALSE(device.isCapturing());
+  ASSERT_THROW(
+    device.endCapture();
+  );
+
+  device.beginCapture();
+  ASSERT_TRUE(device.isCapturing());
+  ASSERT_THROW(
+    device.beginCapture();
+  );
+
+  occa::graph graph = device.endCapture();
+  ASSERT_FALSE(device.isCapturing());
+  ASSERT_TRUE(graph.isInitialized());
+  ASSERT_EQ(graph.size(), 0);
+  ASSERT_EQ(graph.depth(), 0);
+  graph.replay();
+
+  graph.free();
+  ASSERT_FALSE(graph.isInitialized());
+  ASSERT_THROW(
+    graph.replay();
+  );
+}
+
+void testReplay() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+  occa::kernel addOne = device.buildKernelFromString(kernelSource, "addOne");
+  occa::kernel axpy = device.buildKernelFromString(kernelSource, "axpy");
+
+  const int entries = 10;
+  float x[entries], y[entries];
+  for (int i = 0; i < entries; ++i) {
+    x[i] = i;
+    y[i] = -1;
+  }
+
+  occa::memory o_x = device.malloc<float>(entries);
+  occa::memory o_y = device.malloc<float>(entries);
+  o_y.copyFrom(y);
+
+  // Nothing runs while capturing
+  device.beginCapture();
+  o_x.copyFrom(x);
+  addOne(entries, o_x);
+  axpy(entries, 2.0f, o_x, o_y);
+  o_y.copyTo(y);
+  occa::graph graph = device.endCapture();
+
+  ASSERT_EQ(graph.size(), 4);
+  ASSERT_EQ(graph.depth(), 4);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(y[i], -1.0f);
+  }
+
+  // Host memory is read and written on replay
+  for (int replay = 1; replay <= 3; ++replay) {
+    graph.replay();
+    for (int i = 0; i < entries; ++i) {
+      ASSERT_EQ(y[i], (float) (-1 + replay * 2 * (i + 1)));
+    }
+  }
+
+  // Replays don't change the kernel's own arguments
+  addOne.clearArgs();
+  ASSERT_THROW(
+    addOne.run();
+  );
+}
+
+void testDependencies() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+  occa::kernel addOne = device.buildKernelFromString(kernelSource, "addOne");
+  occa::kernel axpy = device.buildKernelFromString(kernelSource, "axpy");
+
+  const int entries = 10;
+  const int vectorCount = 4;
+  float xValues[entries];
+  for (int i = 0; i < entries; ++i) {
+    xValues[i] = (float) i;
+  }
+  occa::memory x = device.malloc<float>(entries, xValues);
+  occa::memory y[vectorCount];
+  for (int i = 0; i < vectorCount; ++i) {
+    y[i] = device.malloc<float>(entries);
+    y[i].copyFrom(x);
+  }
+
+  // Every axpy only reads x, so they're all independent
+  device.beginCapture();
+  for (int i = 0; i < vectorCount; ++i) {
+    axpy(entries, 1.0f, x, y[i]);
+  }
+  occa::graph independentGraph = device.endCapture();
+
+  ASSERT_EQ(independentGraph.size(), vectorCount);
+  ASSERT_EQ(independentGraph.depth(), 1);
+  // Concurrent replays are opt-in
+  ASSERT_FALSE(independentGraph.isConcurrent());
+
+  // Writing to x orders the axpy calls around it
+  device.beginCapture();
+  axpy(entries, 1.0f, x, y[0]);
+  axpy(entries, 1.0f, x, y[1]);
+  addOne(entries, x);
+  axpy(entries, 1.0f, x, y[2]);
+  occa::graph dependentGraph = device.endCapture();
+
+  ASSERT_EQ(dependentGraph.size(), 4);
+  ASSERT_EQ(dependentGraph.depth(), 3);
+
+  // Sequential and concurrent replays give the same results
+  device.beginCapture({
+    {"concurrent", false}
+  });
+  for (int i = 0; i < vectorCount; ++i) {
+    addOne(entries, y[i]);
+    addOne(entries, y[i]);
+    axpy(entries, 2.0f, x, y[i]);
+  }
+  occa::graph sequentialGraph = device.endCapture();
+  ASSERT_FALSE(sequentialGraph.isConcurrent());
+
+  device.beginCapture({
+    {"concurrent", true}
+  });
+  for (int i = 0; i < vectorCount; ++i) {
+    addOne(entries, y[i]);
+    addOne(entries, y[i]);
+    axpy(entries, 2.0f, x, y[i]);
+  }
+  occa::graph concurrentGraph = device.endCapture();
+  ASSERT_EQ(concurrentGraph.depth(), 3);
+
+  float expected[vectorCount][entries];
+  float result[entries];
+
+  for (int i = 0; i < vectorCount; ++i) {
+    y[i].copyFrom(x);
+  }
+  sequentialGraph.replay();
+  for (int i = 0; i < vectorCount; ++i) {
+    y[i].copyTo(expected[i]);
+  }
+
+  for (int i = 0; i < vectorCount; ++i) {
+    y[i].copyFrom(x);
+  }
+  concurrentGraph.replay();
+  for (int i = 0; i < vectorCount; ++i) {
+    y[i].copyTo(result);
+    for (int j = 0; j < entries; ++j) {
+      ASSERT_EQ(result[j], expected[i][j]);
+    }
+  }
+}
+
+void testTags() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+  occa::kernel addOne = device.buildKernelFromString(kernelSource, "addOne");
+
+  const int entries = 10;
+  occa::memory x = device.malloc<float>(entries);
+  occa::memory y = device.malloc<float>(entries);
+
+  device.beginCapture();
+  occa::streamTag capturedTag = device.tagStream();
+  addOne(entries, x);
+  addOne(entries, y);
+  device.tagStream();
+  occa::graph graph = device.endCapture();
+
+  // Only the graph is tagged while capturing
+  ASSERT_FALSE(capturedTag.isInitialized());
+  ASSERT_THROW(
+    device.waitFor(capturedTag);
+  );
+
+  // Tags are barriers around the independent launches
+  ASSERT_EQ(graph.size(), 4);
+  ASSERT_EQ(graph.depth(), 3);
+  ASSERT_EQ((int) graph.tags().size(), 2);
+
+  graph.replay();
+  ASSERT_TRUE(graph.tags()[0].isInitialized());
+  ASSERT_TRUE(graph.tags()[1].isInitialized());
+  ASSERT_TRUE(
+    device.timeBetween(graph.tags()[0], graph.tags()[1]) >= 0
+  );
+}
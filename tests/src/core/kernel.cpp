@@ -2,6 +2,9 @@
 
 #include <occa/internal/io.hpp>
 #include <occa/internal/core/device.hpp>
+#include <occa/internal/core/kernel.hpp>
+#include <occa/internal/modes/serial/jit.hpp>
+#include <occa/internal/utils/sys.hpp>
 #include <occa/internal/utils/testing.hpp>
 
 occa::kernel addVectors;
@@ -15,6 +18,12 @@ void testParsingFailure();
 void testCompilingFailure();
 void testArgumentFailure();
 void testRun();
+void testSharedBinary();
+void testIncrementalBuild();
+void testPrecompiledHeader();
+void testJitBuild();
+void testThreadsTeam();
+void testThreadsTeamLocals();
 
 int main(const int argc, const char **argv) {
   addVectors = occa::buildKernel(addVectorsFile,
@@ -26,6 +35,12 @@ int main(const int argc, const char **argv) {
   testCompilingFailure();
   testArgumentFailure();
   testRun();
+  testSharedBinary();
+  testIncrementalBuild();
+  testPrecompiledHeader();
+  testJitBuild();
+  testThreadsTeam();
+  testThreadsTeamLocals();
 
   return 0;
 }
@@ -189,3 +204,293 @@ void testRun() {
     str.c_str()
   );
 }
+
+void testSharedBinary() {
+  const std::string source = (
+    "@kernel void setOne(int *value) {"
+    "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {"
+    "    value[i] = 1;"
+    "  }"
+    "}"
+    "@kernel void setTwo(int *value) {"
+    "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {"
+    "    value[i] = 2;"
+    "  }"
+    "}"
+  );
+
+  occa::kernel setOne = occa::buildKernelFromString(source, "setOne");
+  occa::kernel setTwo = occa::buildKernelFromString(source, "setTwo");
+
+  // Kernels from the same source share one binary
+  ASSERT_EQ(setOne.binaryFilename(),
+            setTwo.binaryFilename());
+  ASSERT_EQ(setTwo.getModeKernel()->metadata.name,
+            "setTwo");
+
+  int value = 0;
+  occa::memory mem = occa::malloc<int>(1, &value);
+
+  // Freeing one kernel keeps the shared binary loaded
+  setOne(mem);
+  setOne.free();
+
+  mem.copyTo(&value);
+  ASSERT_EQ(value, 1);
+
+  setTwo(mem);
+  mem.copyTo(&value);
+  ASSERT_EQ(value, 2);
+}
+
+int countCachedObjects() {
+  int objects = 0;
+  for (const std::string &dir : occa::io::directories(occa::io::cachePath())) {
+    objects += occa::io::isFile(dir + occa::kc::objectFile);
+  }
+  return objects;
+}
+
+std::string getIncrementalSource(const std::string &salt,
+                                 const int twoValue) {
+  return (
+    "const int salt = " + salt + ";\n"
+    "int getValue(const int value) {\n"
+    "  return value + (salt - salt);\n"
+    "}\n"
+    "@kernel void setOne(int *value) {\n"
+    "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {\n"
+    "    value[i] = getValue(1);\n"
+    "  }\n"
+    "}\n"
+    "@kernel void setTwo(int *value) {\n"
+    "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {\n"
+    "    value[i] = getValue(" + occa::toString(twoValue) + ");\n"
+    "  }\n"
+    "}\n"
+  );
+}
+
+void testIncrementalBuild() {
+  // Count objects in a cache only used by this test
+  const std::string cacheDir = occa::env::OCCA_CACHE_DIR;
+  occa::env::OCCA_CACHE_DIR = cacheDir + "incremental_build_test/";
+  if (occa::io::isDir(occa::io::cachePath())) {
+    occa::sys::rmrf(occa::io::cachePath());
+  }
+
+  const std::string salt = occa::toString(occa::hash_t::random().getInt() & 0xFFFF);
+
+  const occa::json props({{"kernel/incremental", true}});
+
+  int value = 0;
+  occa::memory mem = occa::malloc<int>(1, &value);
+
+  ASSERT_EQ(0, countCachedObjects());
+
+  // Each kernel gets its own object and they share the helper function
+  occa::kernel setTwo = occa::buildKernelFromString(getIncrementalSource(salt, 2), "setTwo", props);
+  ASSERT_EQ(2, countCachedObjects());
+
+  setTwo(mem);
+  mem.copyTo(&value);
+  ASSERT_EQ(value, 2);
+
+  // Only the edited kernel is recompiled
+  setTwo = occa::buildKernelFromString(getIncrementalSource(salt, 3), "setTwo", props);
+  ASSERT_EQ(3, countCachedObjects());
+
+  setTwo(mem);
+  mem.copyTo(&value);
+  ASSERT_EQ(value, 3);
+
+  occa::kernel setOne = occa::buildKernelFromString(getIncrementalSource(salt, 3), "setOne", props);
+  setOne(mem);
+  mem.copyTo(&value);
+  ASSERT_EQ(value, 1);
+
+  // Incremental builds are opt-in
+  occa::kernel fullSetTwo = occa::buildKernelFromString(getIncrementalSource(salt, 4),
+                                                        "setTwo");
+  ASSERT_EQ(3, countCachedObjects());
+
+  fullSetTwo(mem);
+  mem.copyTo(&value);
+  ASSERT_EQ(value, 4);
+
+  occa::env::OCCA_CACHE_DIR = cacheDir;
+}
+
+void testPrecompiledHeader() {
+  // Look for headers in a cache only used by this test
+  const std::string cacheDir = occa::env::OCCA_CACHE_DIR;
+  occa::env::OCCA_CACHE_DIR = cacheDir + "precompiled_header_test/";
+  if (occa::io::isDir(occa::io::cachePath())) {
+    occa::sys::rmrf(occa::io::cachePath());
+  }
+
+  const std::string salt = occa::toString(occa::hash_t::random().getInt() & 0xFFFF);
+  const std::string source = (
+    "@kernel void setRoot(int *value) {\n"
+    "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {\n"
+    "    value[i] = (int) std::sqrt((double) " + salt + " * " + salt + ");\n"
+    "  }\n"
+    "}\n"
+  );
+
+  int value = 0;
+  occa::memory mem = occa::malloc<int>(1, &value);
+
+  // Kernels still build and run with the leading includes precompiled
+  //   Headers are only precompiled when building through the compiler
+  occa::kernel setRoot = occa::buildKernelFromString(source,
+                                                     "setRoot",
+                                                     {{"serial/include_std", true},
+                                                      {"kernel/jit", false}});
+  setRoot(mem);
+  mem.copyTo(&value);
+  ASSERT_EQ(value, std::stoi(salt));
+
+  // Files included by the header are recorded so edits to them rebuild it
+  bool foundHeader = false;
+  for (const std::string &dir : occa::io::directories(occa::io::cachePath())) {
+    if (!occa::io::isFile(dir + occa::kc::precompiledHeader)) {
+      continue;
+    }
+    foundHeader = true;
+    occa::json buildJson = occa::json::read(dir + occa::kc::buildFile);
+    ASSERT_TRUE(buildJson["dependencies"].isObject());
+    ASSERT_TRUE(buildJson["dependencies"].size() > 0);
+    // Continuation lines and escapes in the dependency file are parsed out
+    for (const std::string &dependency : buildJson["dependencies"].keys()) {
+      ASSERT_TRUE(occa::io::isFile(dependency));
+    }
+  }
+  ASSERT_TRUE(foundHeader);
+
+  occa::env::OCCA_CACHE_DIR = cacheDir;
+}
+
+void testJitBuild() {
+  const std::string salt = occa::toString(occa::hash_t::random().getInt() & 0xFFFF);
+  const std::string source = (
+    "@kernel void setSalt(int *value) {\n"
+    "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {\n"
+    "    value[i] = " + salt + ";\n"
+    "  }\n"
+    "}\n"
+  );
+
+  int value = 0;
+  occa::memory mem = occa::malloc<int>(1, &value);
+
+  // Kernels build through the compiler when the JIT isn't available
+  occa::kernel setSalt = occa::buildKernelFromString(source,
+                                                     "setSalt",
+                                                     {{"kernel/jit", true}});
+  setSalt(mem);
+  mem.copyTo(&value);
+  ASSERT_EQ(value, std::stoi(salt));
+
+  const std::string hashDir = occa::io::dirname(setSalt.binaryFilename());
+  ASSERT_EQ(occa::serial::jit::isEnabled(),
+            occa::io::isFile(hashDir + occa::kc::jitObject));
+
+  // Flags the process can't provide always go through the compiler
+  ASSERT_FALSE(occa::serial::jit::canCompile(occa::sys::vendor::GNU, "-O3 -fopenmp", ""));
+  ASSERT_FALSE(occa::serial::jit::canCompile(occa::sys::vendor::GNU, "-O3", "-lfoo"));
+  ASSERT_FALSE(occa::serial::jit::canCompile(occa::sys::vendor::Intel, "-O3", ""));
+  ASSERT_EQ(occa::serial::jit::isEnabled(),
+            occa::serial::jit::canCompile(occa::sys::vendor::LLVM, "-O3 -fPIC -shared", ""));
+}
+
+void testThreadsTeam() {
+  occa::device device({
+    {"mode", "Threads"},
+    {"threads", 4}
+  });
+
+  const std::string source = (
+    "@kernel void teamKernel(const int N, int *counter, int *values) {\n"
+    "  counter[0] += 1;\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {\n"
+    "      if (i == N - 1) {\n"
+    "        return;\n"
+    "      }\n"
+    "      values[i] = i;\n"
+    "    }\n"
+    "  }\n"
+    "  counter[1] += 1;\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {\n"
+    "      values[N + i] = counter[1];\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+
+  const int N = 64;
+  std::vector<int> values(2 * N, -1);
+  int counter[2] = {0, 0};
+
+  occa::memory valuesMem = device.malloc<int>(2 * N, values.data());
+  occa::memory counterMem = device.malloc<int>(2, counter);
+
+  // The last thread returns early without blocking the rest of the team
+  occa::kernel teamKernel = device.buildKernelFromString(source, "teamKernel");
+  teamKernel(N, counterMem, valuesMem);
+
+  valuesMem.copyTo(values.data());
+  counterMem.copyTo(counter);
+
+  // Code outside of @outer loops only runs once
+  ASSERT_EQ(1, counter[0]);
+  ASSERT_EQ(1, counter[1]);
+
+  for (int i = 0; i < (N - 1); ++i) {
+    ASSERT_EQ(i, values[i]);
+  }
+  ASSERT_EQ(-1, values[N - 1]);
+  ASSERT_EQ(1, values[N]);
+}
+
+void testThreadsTeamLocals() {
+  occa::device device({
+    {"mode", "Threads"},
+    {"threads", 4}
+  });
+
+  const std::string source = (
+    "@kernel void localsKernel(const int N, int *counter, int *values) {\n"
+    "  int scale = 1;\n"
+    "  scale = 3;\n"
+    "  const int offset = counter[0]++;\n"
+    "  int pair[2] = {scale, 2 * offset};\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int j = 0; j < 1; ++j; @inner) {\n"
+    "      values[i] = scale + offset + pair[1];\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+
+  const int N = 64;
+  std::vector<int> values(N, -1);
+  int counter = 5;
+
+  occa::memory valuesMem = device.malloc<int>(N, values.data());
+  occa::memory counterMem = device.malloc<int>(1, &counter);
+
+  occa::kernel localsKernel = device.buildKernelFromString(source, "localsKernel");
+  localsKernel(N, counterMem, valuesMem);
+
+  valuesMem.copyTo(values.data());
+  counterMem.copyTo(&counter);
+
+  // Initializers only run once and every thread reads the values set outside @outer loops
+  ASSERT_EQ(6, counter);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(18, values[i]);
+  }
+}
@@ -0,0 +1,82 @@
+#include <occa.hpp>
+#include <occa/internal/utils/testing.hpp>
+
+void testArgsVector();
+void testArgValidation();
+
+int main(const int argc, const char **argv) {
+  testArgsVector();
+  testArgValidation();
+
+  return 0;
+}
+
+void testArgsVector() {
+  occa::inlineKernelArgDataVector args;
+  ASSERT_TRUE(args.empty());
+  ASSERT_TRUE(args.begin() == args.end());
+
+  args.push_back(occa::primitive(1));
+  ASSERT_EQ(args.size(), (size_t) 1);
+  ASSERT_EQ((int) args.front().value, 1);
+
+  args.reserve(4);
+  ASSERT_TRUE(args.capacity() >= 4);
+  ASSERT_EQ((int) args[0].value, 1);
+
+  for (int i = 2; i <= 4; ++i) {
+    args.push_back(occa::primitive(i));
+  }
+  ASSERT_EQ(args.size(), (size_t) 4);
+  ASSERT_EQ((int) args.back().value, 4);
+
+  int sum = 0;
+  for (const occa::kernelArgData &arg : args) {
+    sum += (int) arg.value;
+  }
+  ASSERT_EQ(sum, 10);
+
+  const occa::kernelArgDataVector argsVector = args;
+  ASSERT_EQ(argsVector.size(), (size_t) 4);
+  ASSERT_EQ((int) argsVector[2].value, 3);
+
+  // Back to inline storage
+  args.pop_back();
+  args.pop_back();
+  args.pop_back();
+  ASSERT_EQ(args.size(), (size_t) 1);
+  ASSERT_EQ((int) args.back().value, 1);
+
+  args.clear();
+  ASSERT_TRUE(args.empty());
+}
+
+void testArgValidation() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  const std::string source = (
+    "@kernel void addOne(const int entries, float *values) {\n"
+    "  for (int i = 0; i < entries; ++i; @tile(16, @outer, @inner)) {\n"
+    "    values[i] += 1;\n"
+    "  }\n"
+    "}\n"
+  );
+  occa::kernel addOne = device.buildKernelFromString(source, "addOne");
+
+  const int entries = 4;
+  occa::memory floats = device.malloc<float>(entries);
+  occa::memory ints = device.malloc<int>(entries);
+
+  addOne(entries, floats);
+
+  // Arguments with a different dtype are validated again
+  ASSERT_THROW(
+    addOne(entries, ints);
+  );
+
+  // The same dtype in another allocation still passes
+  occa::memory otherFloats = device.malloc<float>(entries);
+  addOne(entries, otherFloats);
+}
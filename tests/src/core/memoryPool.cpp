@@ -1,15 +1,28 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <occa.hpp>
 #include <occa/internal/utils/testing.hpp>
 
-void testReserve();
+void testReserve(const occa::json &poolProps);
+void testBestFit();
+void testSlabs();
+void testThreadCache();
 
 int main(const int argc, const char **argv) {
-  testReserve();
+  testReserve({});
+  testReserve({
+    {"allocator", "best_fit"}
+  });
+  testBestFit();
+  testSlabs();
+  testThreadCache();
 
   return 0;
 }
 
-void testReserve() {
+void testReserve(const occa::json &poolProps) {
 #define ASSERT_SAME_SIZE(a, b) \
   ASSERT_EQ((size_t) (a), (size_t) (b))
 
@@ -23,7 +36,7 @@ void testReserve() {
     {"mode", "Serial"}
   });
 
-  occa::memoryPool memPool = device.createMemoryPool();
+  occa::memoryPool memPool = device.createMemoryPool(poolProps);
 
   /*Set aligment to 5*sizeof(float) bytes*/
   memPool.setAlignment(5 * sizeof(float));
@@ -165,3 +178,257 @@ void testReserve() {
   delete[] test;
   delete[] data;
 }
+
+void testBestFit() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  ASSERT_THROW(
+    device.createMemoryPool({{"allocator", "foo"}});
+  );
+
+  occa::memoryPool memPool = device.createMemoryPool({
+    {"allocator", "best_fit"}
+  });
+  memPool.setAlignment(16);
+  memPool.resize(16 * 10);
+
+  occa::memory a = memPool.reserve<char>(16);
+  occa::memory b = memPool.reserve<char>(48);
+  occa::memory c = memPool.reserve<char>(16);
+  occa::memory d = memPool.reserve<char>(32);
+  occa::memory e = memPool.reserve<char>(16);
+  ASSERT_SAME_SIZE(memPool.reserved(), 128);
+
+  /*Leave a 48 byte and a 32 byte hole*/
+  char *bPtr = b.ptr<char>();
+  char *dPtr = d.ptr<char>();
+  b.free();
+  d.free();
+  ASSERT_SAME_SIZE(memPool.reserved(), 48);
+
+  /*The smallest hole that fits is used*/
+  occa::memory d2 = memPool.reserve<char>(20);
+  ASSERT_TRUE(d2.ptr<char>() == dPtr);
+
+  occa::memory b2 = memPool.reserve<char>(40);
+  ASSERT_TRUE(b2.ptr<char>() == bPtr);
+
+  ASSERT_SAME_SIZE(memPool.size(), 16 * 10);
+  ASSERT_SAME_SIZE(memPool.reserved(), 128);
+
+  /*Slices keep their block reserved*/
+  occa::memory bSlice = b2.slice(8, 8);
+  b2.free();
+  ASSERT_SAME_SIZE(memPool.reserved(), 128);
+  bSlice.free();
+  ASSERT_SAME_SIZE(memPool.reserved(), 80);
+
+  /*Neighboring holes are merged*/
+  c.free();
+  occa::memory big = memPool.reserve<char>(64);
+  ASSERT_TRUE(big.ptr<char>() == bPtr);
+  ASSERT_SAME_SIZE(memPool.size(), 16 * 10);
+
+  /*Growing packs the reservations*/
+  occa::memory huge = memPool.reserve<char>(64);
+  ASSERT_SAME_SIZE(memPool.size(), 16 * 10 + 32);
+  ASSERT_SAME_SIZE(memPool.reserved(), 16 * 10 + 32);
+
+  memPool.free();
+  ASSERT_SAME_SIZE(device.memoryAllocated(), 0);
+}
+
+void testSlabs() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  ASSERT_THROW(
+    device.createMemoryPool({{"growth", "foo"}});
+  );
+
+  char data[64];
+  char test[64];
+  for (int i = 0; i < 64; ++i) {
+    data[i] = (char) i;
+  }
+
+  occa::memoryPool memPool = device.createMemoryPool({
+    {"growth", "slabs"}
+  });
+  memPool.setAlignment(16);
+  memPool.resize(64);
+  ASSERT_SAME_SIZE(device.memoryAllocated(), 64);
+
+  occa::memory a = memPool.reserve<char>(48);
+  a.copyFrom(data);
+  char *aPtr = a.ptr<char>();
+
+  /*Doesn't fit, adds a slab without moving a*/
+  occa::memory b = memPool.reserve<char>(48);
+  b.copyFrom(data + 16);
+  ASSERT_TRUE(a.ptr<char>() == aPtr);
+  ASSERT_SAME_SIZE(device.memoryAllocated(), 128);
+  ASSERT_SAME_SIZE(memPool.size(), 128);
+  ASSERT_SAME_SIZE(memPool.reserved(), 96);
+  ASSERT_SAME_SIZE(memPool.numReservations(), 2);
+
+  /*Fits in the first slab*/
+  occa::memory c = memPool.reserve<char>(16);
+  ASSERT_SAME_SIZE(memPool.size(), 128);
+  ASSERT_SAME_SIZE(memPool.reserved(), 112);
+
+  a.copyTo(test);
+  for (int i = 0; i < 48; ++i) {
+    ASSERT_EQ((int) test[i], i);
+  }
+
+  /*Empty slabs are released when shrinking*/
+  a.free();
+  c.free();
+  ASSERT_SAME_SIZE(memPool.reserved(), 48);
+  memPool.shrinkToFit();
+  ASSERT_SAME_SIZE(device.memoryAllocated(), 64);
+  ASSERT_SAME_SIZE(memPool.size(), 64);
+
+  memPool.resize(200);
+  ASSERT_SAME_SIZE(memPool.size(), 64 + 144);
+
+  occa::memory d = memPool.reserve<char>(100);
+  d.copyFrom(data, 64);
+  ASSERT_SAME_SIZE(memPool.size(), 64 + 144);
+  ASSERT_SAME_SIZE(memPool.reserved(), 48 + 112);
+
+  /*Compaction packs each slab*/
+  memPool.compact();
+  ASSERT_SAME_SIZE(memPool.size(), 48 + 112);
+  ASSERT_SAME_SIZE(device.memoryAllocated(), 48 + 112);
+
+  b.copyTo(test);
+  for (int i = 0; i < 48; ++i) {
+    ASSERT_EQ((int) test[i], i + 16);
+  }
+  d.copyTo(test, 64);
+  for (int i = 0; i < 64; ++i) {
+    ASSERT_EQ((int) test[i], i);
+  }
+
+  memPool.free();
+  ASSERT_SAME_SIZE(device.memoryAllocated(), 0);
+}
+
+void testThreadCache() {
+  occa::device device({
+    {"mode", "Serial"}
+  });
+
+  occa::memoryPool memPool = device.createMemoryPool({
+    {"thread_cache", true},
+    {"slab_size", 4096}
+  });
+  memPool.setAlignment(64);
+
+  const int threadCount = 4;
+  const int iterations = 200;
+  const int liveCount = 8;
+
+  /*Memory reserved in one thread and freed in another*/
+  std::vector<occa::memory> handoff(threadCount);
+  std::atomic<int> overlaps(0);
+
+  /*Threads stay alive until their caches are checked*/
+  std::atomic<int> finishedThreads(0);
+  std::atomic<bool> canExit(false);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t]() {
+      std::vector<occa::memory> live(liveCount);
+      for (int i = 0; i < iterations; ++i) {
+        occa::memory &mem = live[i % liveCount];
+
+        /*Check no other thread wrote into our reservation*/
+        if (mem.isInitialized()) {
+          const int *ptr = mem.ptr<int>();
+          for (int j = 0; j < (int) mem.length(); ++j) {
+            if (ptr[j] != t) {
+              ++overlaps;
+            }
+          }
+          mem.free();
+        }
+
+        const int entries = 1 + ((i * 7 + t) % 64);
+        mem = memPool.reserve<int>(entries);
+
+        int *ptr = mem.ptr<int>();
+        for (int j = 0; j < entries; ++j) {
+          ptr[j] = t;
+        }
+      }
+      handoff[t] = memPool.reserve<int>(16);
+
+      ++finishedThreads;
+      while (!canExit) {
+        std::this_thread::yield();
+      }
+    });
+  }
+  while (finishedThreads < threadCount) {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ((int) overlaps, 0);
+
+  occa::json stats = memPool.threadCacheStats();
+  ASSERT_EQ((int) stats.size(), threadCount);
+  for (int t = 0; t < threadCount; ++t) {
+    const int hits = stats[t].get<int>("hits");
+    const int misses = stats[t].get<int>("misses");
+    ASSERT_EQ(hits + misses, iterations + 1);
+    ASSERT_TRUE(hits > misses);
+  }
+
+  /*Caches are flushed back to the pool when their thread exits*/
+  const occa::udim_t cachedSize = memPool.size();
+  canExit = true;
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ((int) memPool.threadCacheStats().size(), 0);
+  ASSERT_SAME_SIZE(memPool.size(), cachedSize);
+
+  ASSERT_SAME_SIZE(memPool.numReservations(), threadCount);
+  ASSERT_SAME_SIZE(memPool.reserved(), threadCount * 64);
+
+  handoff.clear();
+  ASSERT_SAME_SIZE(memPool.numReservations(), 0);
+  ASSERT_SAME_SIZE(memPool.reserved(), 0);
+
+  /*Empty slabs are shared between threads*/
+  const occa::udim_t size = memPool.size();
+  std::thread([&]() {
+    occa::memory mem = memPool.reserve<char>(1024);
+  }).join();
+  ASSERT_SAME_SIZE(memPool.size(), size);
+
+  memPool.shrinkToFit();
+  ASSERT_SAME_SIZE(memPool.size(), 0);
+  ASSERT_SAME_SIZE(device.memoryAllocated(), 0);
+
+  /*Freeing a pool drops its cache from threads that are still alive*/
+  {
+    occa::memory mem = memPool.reserve<int>(16);
+  }
+  ASSERT_EQ((int) memPool.threadCacheStats().size(), 1);
+  memPool.free();
+
+  occa::memoryPool memPool2 = device.createMemoryPool({
+    {"thread_cache", true}
+  });
+  occa::memory mem = memPool2.reserve<int>(16);
+  occa::json stats2 = memPool2.threadCacheStats();
+  ASSERT_EQ((int) stats2.size(), 1);
+  ASSERT_EQ(stats2[0].get<int>("misses"), 1);
+}
@@ -3,10 +3,12 @@
 
 void testCreateAndSet();
 void testUnwrap();
+void testAsync();
 
 int main(const int argc, const char **argv) {
   testCreateAndSet();
   testUnwrap();
+  testAsync();
 
   return 0;
 }
@@ -46,3 +48,49 @@ void testUnwrap() {
   // Unwrapping a serial mode stream is undefined
   ASSERT_THROW(occa::unwrap(occa_stream););
 }
+
+void testAsync() {
+  occa::device occa_device({
+    {"mode", "Serial"}
+  });
+
+  occa::kernel step = occa_device.buildKernelFromString(
+    "@kernel void step(const int i, int *value) {\n"
+    "  for (int j = 0; j < 1; ++j; @tile(1, @outer, @inner)) {\n"
+    "    value[j] = 2 * value[j] + i;\n"
+    "  }\n"
+    "}\n",
+    "step"
+  );
+
+  occa::stream async_stream = occa_device.createStream({
+    {"async", true}
+  });
+  occa_device.setStream(async_stream);
+
+  int value = 1;
+  int result = 0;
+  occa::memory value_mem = occa_device.malloc<int>(1);
+
+  // Launches keep their own copy of the arguments and run in order
+  occa::streamTag start_tag = occa_device.tagStream();
+  value_mem.copyFrom(&value, {{"async", true}});
+  int expected = value;
+  for (int i = 0; i < 20; ++i) {
+    step(i, value_mem);
+    expected = 2 * expected + i;
+  }
+  value_mem.copyTo(&result, {{"async", true}});
+  occa::streamTag end_tag = occa_device.tagStream();
+
+  occa_device.waitFor(end_tag);
+  ASSERT_EQ(expected, result);
+  ASSERT_TRUE(0.0 <= occa_device.timeBetween(start_tag, end_tag));
+
+  // Synchronous copies wait for every stream
+  step(100, value_mem);
+  value_mem.copyTo(&result);
+  ASSERT_EQ(2 * expected + 100, result);
+
+  async_stream.finish();
+}
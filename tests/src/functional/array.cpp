@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
 #include <occa.hpp>
 #include <occa/functional.hpp>
 #include <occa/internal/functional/functionStore.hpp>
@@ -59,6 +64,12 @@ void testMax(occa::device device);
 void testMin(occa::device device);
 void testDotProduct(occa::device device);
 void testClamp(occa::device device);
+void testLazy(occa::device device);
+void testScan(occa::device device);
+void testUnique(occa::device device);
+void testSort(occa::device device);
+void testHistogram(occa::device device);
+void testReduceByKey(occa::device device);
 
 int main(const int argc, const char **argv) {
   std::vector<occa::device> devices = {
@@ -68,6 +79,10 @@ int main(const int argc, const char **argv) {
     occa::device({
       {"mode", "OpenMP"}
     }),
+    occa::device({
+      {"mode", "Threads"},
+      {"threads", 4}
+    }),
     occa::device({
       {"mode", "CUDA"},
       {"device_id", 0}
@@ -105,6 +120,12 @@ int main(const int argc, const char **argv) {
     testMin(device);
     testDotProduct(device);
     testClamp(device);
+    testLazy(device);
+    testScan(device);
+    testUnique(device);
+    testSort(device);
+    testHistogram(device);
+    testReduceByKey(device);
   }
 
   return 0;
@@ -290,7 +311,6 @@ void testSome(occa::device device) {
 }
 
 void testFilter(occa::device device) {
-#if 0
   context ctx(device);
 
   occa::array<int> filteredArray;
@@ -339,7 +359,16 @@ void testFilter(occa::device device) {
   ASSERT_EQ(5, (int) filteredArray.length());
   ASSERT_EQ(5, filteredArray.min());
   ASSERT_EQ(ctx.maxValue, filteredArray.max());
-#endif
+
+  filteredArray = (
+    ctx.array
+    .filter(OCCA_FUNCTION([](const int &value) -> bool {
+      return value > 100;
+    }))
+  );
+
+  ASSERT_EQ(0, (int) filteredArray.length());
+  ASSERT_EQ(ctx.device, filteredArray.getDevice());
 }
 
 void testFindIndex(occa::device device) {
@@ -906,3 +935,394 @@ void testClamp(occa::device device) {
   ASSERT_EQ(0, clampedArray.min());
   ASSERT_EQ(7, clampedArray.max());
 }
+
+occa::function<int(const int&)> getMultiplyOffset(const int offset) {
+  occa::scope multiplyScope({
+    {"offset", offset}
+  });
+  return OCCA_FUNCTION(multiplyScope, [=](const int &value) -> int {
+    return value * offset;
+  });
+}
+
+void testLazy(occa::device device) {
+  context ctx(device);
+
+  ASSERT_EQ(0, ctx.array.lazy().stageCount());
+
+  // Chained maps
+  ASSERT_EQ(
+    (float) 32.5,
+    ctx.array.lazy()
+    .map<float>(OCCA_FUNCTION([](const int &value) -> float {
+      return value / 2.0;
+    }))
+    .map<float>(OCCA_FUNCTION([](const float &value) -> float {
+      return value + 1;
+    }))
+    .sum()
+  );
+
+  ASSERT_EQ(
+    285,
+    ctx.array.lazy()
+    .map<int>(OCCA_FUNCTION([](const int &value, const int index) -> int {
+      return value * index;
+    }))
+    .sum()
+  );
+
+  // Reductions start from their identity since the first value changed type
+  ASSERT_EQ(
+    (float) -11,
+    ctx.array.lazy()
+    .map<float>(OCCA_FUNCTION([](const int &value) -> float {
+      return value - 20;
+    }))
+    .max()
+  );
+
+  // Filters
+  auto isEven = OCCA_FUNCTION([](const int &value) -> bool {
+    return (value % 2) == 0;
+  });
+
+  ASSERT_EQ(5,
+            ctx.array.lazy()
+            .filter(OCCA_FUNCTION([](const int &value) -> bool {
+              return value >= 5;
+            }))
+            .min());
+
+  ASSERT_EQ(4,
+            ctx.array.lazy()
+            .filter(OCCA_FUNCTION([](const int &value, const int index) -> bool {
+              return index < 5;
+            }))
+            .max());
+
+  ASSERT_EQ(20,
+            ctx.array.lazy()
+            .filter(isEven)
+            .reduce<int>(
+              occa::reductionType::sum,
+              0,
+              OCCA_FUNCTION([](const int &acc, const int &value) -> int {
+                return acc + value;
+              })
+            ));
+
+  ASSERT_EQ(std::numeric_limits<int>::lowest(),
+            ctx.array.lazy()
+            .filter(OCCA_FUNCTION([](const int &value) -> bool {
+              return value > 100;
+            }))
+            .max());
+
+  ctx.array.lazy()
+    .filter(isEven)
+    .forEach(OCCA_FUNCTION([](const int &value, const int index) -> void {
+      // Do nothing
+    }));
+
+  // Stages can capture the same names
+  const int offset = 1;
+  occa::scope addScope({
+    {"offset", offset}
+  });
+  auto addOffset = OCCA_FUNCTION(addScope, [=](const int &value) -> int {
+    return value + offset;
+  });
+
+  auto multiplyOffset = getMultiplyOffset(2);
+
+  ASSERT_EQ(110,
+            ctx.array.lazy()
+            .map<int>(addOffset)
+            .map<int>(multiplyOffset)
+            .sum());
+
+  ASSERT_EQ(330,
+            ctx.array.lazy()
+            .map<int>(addOffset)
+            .dotProduct(ctx.array));
+
+  // Evaluating to an array
+  occa::array<int> mappedArray = (
+    ctx.array.lazy()
+    .map<int>(multiplyOffset)
+    .map<int>(addOffset)
+    .toArray()
+  );
+
+  ASSERT_EQ(ctx.length, (int) mappedArray.length());
+  ASSERT_EQ(1, mappedArray.min());
+  ASSERT_EQ(19, mappedArray.max());
+  ASSERT_EQ(ctx.minValue, ctx.array.min());
+  ASSERT_EQ(ctx.maxValue, ctx.array.max());
+
+  ASSERT_NEQ(ctx.array.memory(),
+             ctx.array.lazy().toArray().memory());
+
+  ASSERT_THROW(
+    ctx.array.lazy().filter(isEven).toArray();
+  );
+}
+
+std::vector<int> getRandomValues(const int entries,
+                                 const int minValue,
+                                 const int maxValue) {
+  std::vector<int> values(entries);
+  unsigned int seed = 1;
+  for (int i = 0; i < entries; ++i) {
+    seed = (1103515245 * seed) + 12345;
+    values[i] = minValue + (int) ((seed >> 8) % (maxValue - minValue + 1));
+  }
+  return values;
+}
+
+void testScan(occa::device device) {
+  context ctx(device);
+
+  occa::array<int> scannedArray = ctx.array.inclusiveScan();
+  ASSERT_EQ(ctx.length, (int) scannedArray.length());
+  for (int i = 0; i < ctx.length; ++i) {
+    ASSERT_EQ((i * (i + 1)) / 2, scannedArray[i]);
+  }
+
+  scannedArray = ctx.array.exclusiveScan();
+  for (int i = 0; i < ctx.length; ++i) {
+    ASSERT_EQ((i * (i - 1)) / 2, scannedArray[i]);
+  }
+
+  scannedArray = ctx.array.exclusiveScan(occa::reductionType::max);
+  ASSERT_EQ(std::numeric_limits<int>::lowest(), scannedArray[0]);
+  ASSERT_EQ(8, scannedArray[9]);
+
+  // Spans multiple blocks and tiles
+  const int entries = 5000;
+  std::vector<int> values = getRandomValues(entries, -100, 100);
+
+  occa::array<int> array(device, entries);
+  array.copyFrom(values.data());
+
+  std::vector<int> expected(entries);
+  std::vector<int> result(entries);
+
+  std::partial_sum(values.begin(), values.end(), expected.begin());
+  array.inclusiveScan().copyTo(result.data());
+  ASSERT_TRUE(expected == result);
+
+  int minValue = std::numeric_limits<int>::max();
+  for (int i = 0; i < entries; ++i) {
+    expected[i] = minValue;
+    minValue = std::min(minValue, values[i]);
+  }
+  array.exclusiveScan(occa::reductionType::min).copyTo(result.data());
+  ASSERT_TRUE(expected == result);
+
+  occa::array<float> floatArray = array.cast<float>().exclusiveScan();
+  ASSERT_EQ((float) (std::accumulate(values.begin(), values.end() - 1, 0)),
+            floatArray[entries - 1]);
+}
+
+void testUnique(occa::device device) {
+  const int values[10] = {1, 1, 2, 2, 2, 3, 1, 1, 4, 4};
+
+  occa::array<int> array(device, 10);
+  array.copyFrom(values);
+
+  occa::array<int> uniqueArray = array.unique();
+  ASSERT_EQ(5, (int) uniqueArray.length());
+
+  int uniqueValues[5];
+  uniqueArray.copyTo(uniqueValues);
+  ASSERT_EQ(1, uniqueValues[0]);
+  ASSERT_EQ(2, uniqueValues[1]);
+  ASSERT_EQ(3, uniqueValues[2]);
+  ASSERT_EQ(1, uniqueValues[3]);
+  ASSERT_EQ(4, uniqueValues[4]);
+
+  ASSERT_EQ(4, (int) array.sort().unique().length());
+}
+
+void testSort(occa::device device) {
+  const int entries = 3000;
+  std::vector<int> values = getRandomValues(entries, -100000, 100000);
+
+  occa::array<int> array(device, entries);
+  array.copyFrom(values.data());
+
+  // Integers
+  std::vector<int> expected = values;
+  std::vector<int> result(entries);
+
+  std::sort(expected.begin(), expected.end());
+  occa::array<int> sortedArray = array.sort();
+  sortedArray.copyTo(result.data());
+  ASSERT_TRUE(expected == result);
+
+  // The input isn't modified
+  array.copyTo(result.data());
+  ASSERT_TRUE(values == result);
+
+  // Unsigned integers and chars
+  std::vector<unsigned int> unsignedValues(values.begin(), values.end());
+  std::vector<unsigned int> unsignedResult(entries);
+
+  occa::array<unsigned int> unsignedArray(device, entries);
+  unsignedArray.copyFrom(unsignedValues.data());
+  std::sort(unsignedValues.begin(), unsignedValues.end());
+  unsignedArray.sort().copyTo(unsignedResult.data());
+  ASSERT_TRUE(unsignedValues == unsignedResult);
+
+  std::vector<char> charValues(entries);
+  for (int i = 0; i < entries; ++i) {
+    charValues[i] = (char) (values[i] % 100);
+  }
+  std::vector<char> charResult(entries);
+
+  occa::array<char> charArray(device, entries);
+  charArray.copyFrom(charValues.data());
+  std::sort(charValues.begin(), charValues.end());
+  charArray.sort().copyTo(charResult.data());
+  ASSERT_TRUE(charValues == charResult);
+
+  // Floating point
+  std::vector<double> doubleValues(entries);
+  for (int i = 0; i < entries; ++i) {
+    doubleValues[i] = values[i] / 7.0;
+  }
+  std::vector<double> doubleResult(entries);
+
+  occa::array<double> doubleArray(device, entries);
+  doubleArray.copyFrom(doubleValues.data());
+  std::sort(doubleValues.begin(), doubleValues.end());
+  doubleArray.sort().copyTo(doubleResult.data());
+  ASSERT_TRUE(doubleValues == doubleResult);
+
+  ASSERT_EQ(
+    (float) -1.5,
+    occa::array<int>(array.slice(0, 4))
+    .map<float>(OCCA_FUNCTION([](const int &value, const int index) -> float {
+      return index ? index : -1.5;
+    }))
+    .sort()[0]
+  );
+
+  // Keys with values, which keep their order among equal keys
+  occa::array<int> keys = array.map<int>(
+    OCCA_FUNCTION([](const int &value) -> int {
+      return value % 10;
+    })
+  );
+  occa::array<int> indices = array.map<int>(
+    OCCA_FUNCTION([](const int &value, const int index) -> int {
+      return index;
+    })
+  );
+
+  std::vector<int> keyValues(entries);
+  keys.copyTo(keyValues.data());
+
+  std::vector<int> expectedIndices(entries);
+  for (int i = 0; i < entries; ++i) {
+    expectedIndices[i] = i;
+  }
+  std::stable_sort(expectedIndices.begin(), expectedIndices.end(),
+                   [&](const int a, const int b) {
+                     return keyValues[a] < keyValues[b];
+                   });
+
+  occa::array<int> sortedKeys = keys.sortByKey(indices);
+  ASSERT_EQ(entries, (int) indices.length());
+
+  indices.copyTo(result.data());
+  ASSERT_TRUE(expectedIndices == result);
+
+  sortedKeys.copyTo(result.data());
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(keyValues[expectedIndices[i]], result[i]);
+  }
+
+  // Empty arrays
+  occa::array<int> emptyArray = (
+    array
+    .filter(OCCA_FUNCTION([](const int &value) -> bool {
+      return value > 1000000;
+    }))
+    .sort()
+  );
+  ASSERT_EQ(0, (int) emptyArray.length());
+  ASSERT_EQ(device, emptyArray.getDevice());
+}
+
+void testHistogram(occa::device device) {
+  context ctx(device);
+
+  occa::array<int> counts = ctx.array.histogram(5, 0, 9);
+  ASSERT_EQ(5, (int) counts.length());
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(2, counts[i]);
+  }
+
+  // Values outside the range aren't counted and the maximum is in the last bin
+  counts = ctx.array.histogram(3, 2, 5);
+  ASSERT_EQ(1, counts[0]);
+  ASSERT_EQ(1, counts[1]);
+  ASSERT_EQ(2, counts[2]);
+
+  const int entries = 4000;
+  std::vector<int> values = getRandomValues(entries, 0, 99);
+
+  occa::array<int> array(device, entries);
+  array.copyFrom(values.data());
+
+  std::vector<int> expected(10, 0);
+  for (const int value : values) {
+    ++expected[value / 10];
+  }
+  std::vector<int> result(10);
+
+  array.histogram(10, 0, 100).copyTo(result.data());
+  ASSERT_TRUE(expected == result);
+
+  ASSERT_THROW(
+    ctx.array.histogram(0, 0, 9);
+  );
+  ASSERT_THROW(
+    ctx.array.histogram(5, 9, 0);
+  );
+}
+
+void testReduceByKey(occa::device device) {
+  const int keyValues[10] = {1, 1, 2, 2, 2, 3, 1, 1, 4, 4};
+  const float values[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+  occa::array<int> keys(device, 10);
+  keys.copyFrom(keyValues);
+
+  occa::array<float> valueArray(device, 10);
+  valueArray.copyFrom(values);
+
+  occa::array<float> reducedValues;
+  occa::array<int> reducedKeys = keys.reduceByKey(valueArray, reducedValues);
+
+  ASSERT_EQ(5, (int) reducedKeys.length());
+  ASSERT_EQ(5, (int) reducedValues.length());
+
+  const int expectedKeys[5] = {1, 2, 3, 1, 4};
+  const float expectedValues[5] = {3, 12, 6, 15, 19};
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(expectedKeys[i], reducedKeys[i]);
+    ASSERT_EQ(expectedValues[i], reducedValues[i]);
+  }
+
+  keys.reduceByKey(valueArray, reducedValues, occa::reductionType::max);
+  ASSERT_EQ((float) 2, reducedValues[0]);
+  ASSERT_EQ((float) 10, reducedValues[4]);
+
+  ASSERT_THROW(
+    keys.slice(0, 5).reduceByKey(valueArray, reducedValues);
+  );
+}
@@ -0,0 +1,115 @@
+#include <utime.h>
+
+#include <occa/internal/io.hpp>
+#include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/sys.hpp>
+#include <occa/internal/utils/testing.hpp>
+
+void testFingerprint();
+void testCachedHashes();
+void testPersistence();
+
+std::string testDir;
+
+int main(const int argc, const char **argv) {
+  testDir = occa::env::OCCA_CACHE_DIR + "file_hash_cache_test/";
+  occa::sys::rmrf(testDir);
+  occa::sys::mkpath(testDir);
+
+  testFingerprint();
+  testCachedHashes();
+  testPersistence();
+
+  occa::sys::rmrf(testDir);
+
+  return 0;
+}
+
+// Move mtime into the past so the file is old enough to cache
+void writeOldFile(const std::string &filename,
+                  const std::string &content,
+                  const time_t mtime) {
+  occa::io::write(filename, content);
+
+  struct utimbuf times;
+  times.actime = mtime;
+  times.modtime = mtime;
+  utime(filename.c_str(), &times);
+}
+
+void testFingerprint() {
+  const std::string filename = testDir + "fingerprint.okl";
+  occa::io::fileFingerprint_t fingerprint, fingerprint2;
+
+  ASSERT_FALSE(occa::io::getFileFingerprint(filename, fingerprint));
+  ASSERT_FALSE(occa::io::getFileFingerprint(testDir, fingerprint));
+
+  writeOldFile(filename, "foo", 1000);
+  ASSERT_TRUE(occa::io::getFileFingerprint(filename, fingerprint));
+  ASSERT_EQ(fingerprint.size, (occa::udim_t) 3);
+  ASSERT_EQ(fingerprint.mtime, (occa::udim_t) 1000 * 1000000000);
+
+  writeOldFile(filename, "bar", 2000);
+  ASSERT_TRUE(occa::io::getFileFingerprint(filename, fingerprint2));
+  ASSERT_TRUE(fingerprint != fingerprint2);
+}
+
+void testCachedHashes() {
+  occa::io::fileHashCache_t &cache = occa::io::fileHashCache_t::getInstance();
+  cache.clear();
+
+  const std::string filename = testDir + "cached.okl";
+
+  writeOldFile(filename, "foo", 1000);
+  ASSERT_EQ(occa::hashFile(filename), occa::hash("foo"));
+  ASSERT_EQ(cache.cacheMisses(), (occa::udim_t) 1);
+
+  ASSERT_EQ(occa::hashFile(filename), occa::hash("foo"));
+  ASSERT_EQ(cache.cacheHits(), (occa::udim_t) 1);
+
+  // A new mtime invalidates the entry
+  writeOldFile(filename, "bar", 2000);
+  ASSERT_EQ(occa::hashFile(filename), occa::hash("bar"));
+  ASSERT_EQ(cache.cacheMisses(), (occa::udim_t) 2);
+
+  // Recently modified files are always re-read
+  occa::io::write(filename, "baz");
+  ASSERT_EQ(occa::hashFile(filename), occa::hash("baz"));
+  ASSERT_EQ(occa::hashFile(filename), occa::hash("baz"));
+  ASSERT_EQ(cache.cacheHits(), (occa::udim_t) 1);
+  ASSERT_EQ(cache.cacheMisses(), (occa::udim_t) 4);
+
+  ASSERT_THROW(
+    occa::hashFile(testDir + "missing.okl");
+  );
+}
+
+void testPersistence() {
+  occa::io::fileHashCache_t &cache = occa::io::fileHashCache_t::getInstance();
+  cache.clear();
+
+  const std::string filename = testDir + "persisted.okl";
+  writeOldFile(filename, "foo", 1000);
+
+  const std::string cacheDir = occa::env::OCCA_CACHE_DIR;
+  occa::env::OCCA_CACHE_DIR = testDir;
+
+  cache.setPersistent(true);
+  occa::hashFile(filename);
+  cache.save();
+  ASSERT_TRUE(occa::io::isFile(testDir + "file_hashes.json"));
+
+  // Reloading the saved fingerprints skips the read
+  cache.setPersistent(false);
+  cache.clear();
+  cache.setPersistent(true);
+
+  ASSERT_EQ(occa::hashFile(filename), occa::hash("foo"));
+  ASSERT_EQ(cache.cacheHits(), (occa::udim_t) 1);
+  ASSERT_EQ(cache.cacheMisses(), (occa::udim_t) 0);
+
+  cache.setPersistent(false);
+  cache.clear();
+
+  occa::env::OCCA_CACHE_DIR = cacheDir;
+}
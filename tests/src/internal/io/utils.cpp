@@ -125,8 +125,9 @@ void testDirMethods() {
   // Find files
   occa::strVector files = occa::io::files(ioDir);
   ASSERT_EQ((int) files.size(),
-            2);
+            3);
   ASSERT_IN(ioDir + "cache.cpp", files);
+  ASSERT_IN(ioDir + "fileHashCache.cpp", files);
   ASSERT_IN(ioDir + "utils.cpp", files);
 
   // Check if files exists
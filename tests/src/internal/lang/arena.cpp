@@ -0,0 +1,101 @@
+#include <list>
+#include <thread>
+
+#include <occa/internal/utils/testing.hpp>
+
+#include <occa/internal/lang/arena.hpp>
+#include <occa/internal/lang/token.hpp>
+
+using namespace occa::lang;
+
+void testBlockReuse();
+void testLargeObjects();
+void testAllocator();
+void testThreads();
+
+int main(const int argc, const char **argv) {
+  testBlockReuse();
+  testLargeObjects();
+  testAllocator();
+  testThreads();
+
+  return 0;
+}
+
+void testBlockReuse() {
+  void *a = arena::allocate(24);
+  void *b = arena::allocate(24);
+  ASSERT_NEQ(a, b);
+  ASSERT_EQ(0, (int) (((size_t) a) % arena::alignment));
+  ASSERT_EQ(0, (int) (((size_t) b) % arena::alignment));
+
+  // Freed blocks are handed back to objects of the same size class
+  arena::release(a, 24);
+  void *c = arena::allocate(30);
+  ASSERT_EQ(a, c);
+
+  arena::release(b, 24);
+  arena::release(c, 30);
+
+  ASSERT_TRUE(arena::reservedBytes() >= arena::chunkBytes);
+}
+
+void testLargeObjects() {
+  const size_t reservedBytes = arena::reservedBytes();
+
+  void *ptr = arena::allocate(10 * arena::maxObjectBytes);
+  ASSERT_EQ(reservedBytes, arena::reservedBytes());
+  arena::release(ptr, 10 * arena::maxObjectBytes);
+
+  arena::release(NULL, 24);
+}
+
+void testAllocator() {
+  std::list<int, arenaAllocator<int>> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(i);
+  }
+  int sum = 0;
+  for (int value : values) {
+    sum += value;
+  }
+  ASSERT_EQ(999 * 500, sum);
+
+  // Tokens go through the class operator new/delete
+  token_t *token = new newlineToken(fileOrigin());
+  ASSERT_EQ("\n", token->str());
+  delete token;
+}
+
+void testThreads() {
+  // Blocks can be released on a different thread
+  void *ptrs[100];
+  std::thread allocThread([&]() {
+    for (int i = 0; i < 100; ++i) {
+      ptrs[i] = arena::allocate(64);
+    }
+  });
+  allocThread.join();
+
+  std::thread releaseThread([&]() {
+    for (int i = 0; i < 100; ++i) {
+      arena::release(ptrs[i], 64);
+    }
+  });
+  releaseThread.join();
+
+  // Blocks and chunks of exited threads are reused by new threads
+  const size_t reservedBytes = arena::reservedBytes();
+  for (int t = 0; t < 20; ++t) {
+    std::thread thread([&]() {
+      for (int i = 0; i < 100; ++i) {
+        ptrs[i] = arena::allocate(64);
+      }
+      for (int i = 0; i < 100; ++i) {
+        arena::release(ptrs[i], 64);
+      }
+    });
+    thread.join();
+  }
+  ASSERT_TRUE(arena::reservedBytes() <= reservedBytes + arena::chunkBytes);
+}
@@ -0,0 +1,228 @@
+#include <utime.h>
+
+#include <occa/internal/io.hpp>
+#include <occa/internal/utils/env.hpp>
+#include <occa/internal/utils/sys.hpp>
+#include <occa/internal/utils/testing.hpp>
+
+#include <occa/internal/lang/fileCache.hpp>
+#include <occa/internal/lang/token.hpp>
+#include <occa/internal/lang/tokenizer.hpp>
+
+using namespace occa::lang;
+
+void testCachedFiles();
+void testReplayedTokens();
+void testIncludeGuards();
+
+std::string testDir;
+
+int main(const int argc, const char **argv) {
+  testDir = occa::env::OCCA_CACHE_DIR + "lang_file_cache_test/";
+  occa::sys::rmrf(testDir);
+  occa::sys::mkpath(testDir);
+
+  testCachedFiles();
+  testReplayedTokens();
+  testIncludeGuards();
+
+  fileCache_t::getInstance().clear();
+  occa::sys::rmrf(testDir);
+
+  return 0;
+}
+
+// Move mtime into the past so the file is old enough to cache
+void writeOldFile(const std::string &filename,
+                  const std::string &content,
+                  const time_t mtime) {
+  occa::io::write(filename, content);
+
+  struct utimbuf times;
+  times.actime = mtime;
+  times.modtime = mtime;
+  utime(filename.c_str(), &times);
+}
+
+void testCachedFiles() {
+  fileCache_t &cache = fileCache_t::getInstance();
+  cache.clear();
+
+  const std::string filename = testDir + "cached.okl";
+
+  writeOldFile(filename, "int a = 1;\n", 1000);
+  file_t *file = cache.load(filename);
+  ASSERT_EQ("int a = 1;\n", file->content);
+  ASSERT_EQ(-1, file->getRefs());
+  // [int] [a] [=] [1] [;] [\n]
+  ASSERT_EQ(6, (int) file->cachedTokens.size());
+  ASSERT_EQ(cache.cacheMisses(), (occa::udim_t) 1);
+
+  ASSERT_TRUE(cache.load(filename) == file);
+  ASSERT_EQ(cache.cacheHits(), (occa::udim_t) 1);
+
+  // A new mtime invalidates the entry but keeps the old file alive
+  writeOldFile(filename, "int b = 2;\n", 2000);
+  file_t *file2 = cache.load(filename);
+  ASSERT_TRUE(file2 != file);
+  ASSERT_EQ("int b = 2;\n", file2->content);
+  ASSERT_EQ("int a = 1;\n", file->content);
+  ASSERT_EQ(cache.cacheMisses(), (occa::udim_t) 2);
+
+  // Recently modified files aren't shared
+  occa::io::write(filename, "int c = 3;\n");
+  file_t *file3 = cache.load(filename);
+  ASSERT_EQ("int c = 3;\n", file3->content);
+  ASSERT_EQ(0, file3->getRefs());
+  ASSERT_EQ(0, (int) file3->cachedTokens.size());
+  delete file3;
+
+  // #line would rename the file for everyone sharing it
+  writeOldFile(filename, "#line 10 \"foo.okl\"\nint d = 4;\n", 3000);
+  file_t *file4 = cache.load(filename);
+  ASSERT_EQ(0, file4->getRefs());
+  ASSERT_EQ(0, (int) file4->cachedTokens.size());
+  delete file4;
+
+  // Sources with errors are lexed each time so the errors are reported
+  writeOldFile(filename, "const char *s = \"missing quote;\n", 4000);
+  file_t *file5 = cache.load(filename);
+  ASSERT_EQ(0, file5->getRefs());
+  delete file5;
+
+  cache.clear();
+  ASSERT_EQ(cache.cacheHits(), (occa::udim_t) 0);
+  ASSERT_EQ(cache.cacheMisses(), (occa::udim_t) 0);
+}
+
+std::string getTokens(file_t *file) {
+  std::string tokens;
+  tokenizer_t tokenizer(file);
+  while (!tokenizer.isEmpty()) {
+    token_t *token;
+    tokenizer >> token;
+    if (token) {
+      tokens += (
+        occa::toString(token->type())
+        + ':' + occa::toString(token->origin.position.line)
+        + ':' + token->str() + '\n'
+      );
+      delete token;
+    }
+  }
+  return tokens;
+}
+
+void testReplayedTokens() {
+  const std::string filename = testDir + "replay.okl";
+  const std::string content = (
+    "// Line comment\n"
+    "#define FOO(a, b) \\\n"
+    "  (a + b)\n"
+    "/* Block\n"
+    "   comment */\n"
+    "@kernel void foo(const float *x, int n) {\n"
+    "  const char *s = u8\"string\";\n"
+    "  const char c = 'c';\n"
+    "  double d = 1.5e-3 + 0x10 + .25f;\n"
+    "  n <<= sizeof(x) >> 2;\n"
+    "}"
+  );
+
+  writeOldFile(filename, content, 1000);
+  file_t *file = fileCache_t::getInstance().load(filename);
+  ASSERT_TRUE(file->cachedTokens.size() > 0);
+
+  // Replayed tokens match freshly lexed tokens
+  ASSERT_EQ(getTokens(new file_t(filename, content)),
+            getTokens(file));
+
+  // Replaying from the middle of the file
+  tokenizer_t tokenizer(file);
+  tokenizer.fp.start = file->content.c_str() + content.find("double");
+  tokenizer.fp.line = 9;
+  token_t *token;
+  tokenizer >> token;
+  ASSERT_EQ("double", token->str());
+  ASSERT_EQ(9, token->origin.position.line);
+  ASSERT_TRUE(tokenizer.cachedTokenIndex > 0);
+  delete token;
+}
+
+std::string getIncludeGuard(const std::string &content) {
+  static int mtime = 1000;
+
+  const std::string filename = testDir + "guard.hpp";
+  writeOldFile(filename, content, mtime++);
+  return fileCache_t::getInstance().load(filename)->includeGuard;
+}
+
+void testIncludeGuards() {
+  ASSERT_EQ("FOO_HPP",
+            getIncludeGuard(
+              "// Copyright\n"
+              "#ifndef FOO_HPP\n"
+              "#define FOO_HPP\n"
+              "#ifdef BAR\n"
+              "int bar;\n"
+              "#else\n"
+              "int baz;\n"
+              "#endif\n"
+              "#endif\n"
+              "\n"
+            ));
+
+  ASSERT_EQ("FOO_HPP",
+            getIncludeGuard(
+              "#ifndef FOO_HPP\n"
+              "#define FOO_HPP 1\n"
+              "int foo;\n"
+              "#endif // FOO_HPP"
+            ));
+
+  // Code outside of the guard
+  ASSERT_EQ("",
+            getIncludeGuard(
+              "#ifndef FOO_HPP\n"
+              "#define FOO_HPP\n"
+              "#endif\n"
+              "int foo;\n"
+            ));
+
+  ASSERT_EQ("",
+            getIncludeGuard(
+              "int foo;\n"
+              "#ifndef FOO_HPP\n"
+              "#define FOO_HPP\n"
+              "#endif\n"
+            ));
+
+  // The #ifndef has other branches
+  ASSERT_EQ("",
+            getIncludeGuard(
+              "#ifndef FOO_HPP\n"
+              "#define FOO_HPP\n"
+              "#else\n"
+              "int foo;\n"
+              "#endif\n"
+            ));
+
+  // Defines a different macro
+  ASSERT_EQ("",
+            getIncludeGuard(
+              "#ifndef FOO_HPP\n"
+              "#define BAR_HPP\n"
+              "#endif\n"
+            ));
+
+  // Two separate blocks
+  ASSERT_EQ("",
+            getIncludeGuard(
+              "#ifndef FOO_HPP\n"
+              "#define FOO_HPP\n"
+              "#endif\n"
+              "#ifndef BAR_HPP\n"
+              "#define BAR_HPP\n"
+              "#endif\n"
+            ));
+}
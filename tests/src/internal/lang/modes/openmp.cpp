@@ -4,6 +4,8 @@
 #include "../parserUtils.hpp"
 
 void testPragma();
+void testCollapse();
+void testSchedule();
 void testAtomic();
 
 int main(const int argc, const char **argv) {
@@ -11,6 +13,8 @@ int main(const int argc, const char **argv) {
   parser.settings["serial/include_std"] = false;
 
   testPragma();
+  testCollapse();
+  testSchedule();
   testAtomic();
 
   return 0;
@@ -31,6 +35,20 @@ int main(const int argc, const char **argv) {
               ompPragma.value());                                       \
   } while(0)
 
+#define ASSERT_LAST_PRAGMA(PRAGMA_SOURCE)                               \
+  do {                                                                  \
+    statementArray pragmaStatements = (                                 \
+      parser.root.children                                              \
+      .flatFilterByStatementType(statementType::pragma)                 \
+    );                                                                  \
+                                                                        \
+    pragmaStatement &ompPragma = (                                      \
+      pragmaStatements.last()->to<pragmaStatement>()                    \
+    );                                                                  \
+    ASSERT_EQ(PRAGMA_SOURCE,                                            \
+              ompPragma.value());                                       \
+  } while(0)
+
 //---[ Pragma ]-------------------------
 void testPragma() {
   // @outer -> #pragma omp
@@ -41,6 +59,93 @@ void testPragma() {
   );
   ASSERT_PRAGMA_EXISTS("omp parallel for", 1);
 }
+
+void testCollapse() {
+  // Perfectly nested @outer loops
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < N; ++i; @outer) {\n"
+    "      for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp parallel for collapse(2)", 1);
+
+  // Inner bounds depend on the outer iterator
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < j; ++i; @outer) {\n"
+    "      for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp parallel for", 1);
+
+  // Statements between @outer loops
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    const int N2 = 2 * N;\n"
+    "    for (int i = 0; i < N2; ++i; @outer) {\n"
+    "      for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp parallel for", 1);
+
+  parser.settings["openmp/collapse"] = false;
+  parseSource(
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < N; ++i; @outer) {\n"
+    "      for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_PRAGMA_EXISTS("omp parallel for", 1);
+  parser.settings.remove("openmp");
+}
+
+void testSchedule() {
+  const std::string kernelSource = (
+    "@kernel void foo(const int N) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < N; ++i; @outer) {\n"
+    "      for (int k = 0; k < N; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+
+  parser.settings["openmp/schedule"] = "guided";
+  parseSource(kernelSource);
+  ASSERT_PRAGMA_EXISTS("omp parallel for schedule(guided) collapse(2)", 1);
+
+  parser.settings["openmp/chunk"] = 4;
+  parser.settings["openmp/schedule"] = "dynamic";
+  parseSource(kernelSource);
+  ASSERT_PRAGMA_EXISTS("omp parallel for schedule(dynamic, 4) collapse(2)", 1);
+
+  parser.settings["openmp/schedule"] = "runtime";
+  parseSource(kernelSource);
+  ASSERT_PRAGMA_EXISTS("omp parallel for schedule(runtime) collapse(2)", 1);
+
+  parser.settings["openmp/schedule"] = "work_stealing";
+  parseSource(kernelSource);
+  ASSERT_PRAGMA_EXISTS("omp parallel", 3);
+  ASSERT_LAST_PRAGMA("omp taskloop grainsize(4) collapse(2)");
+
+  parser.settings["openmp/schedule"] = "fastest";
+  parseBadSource(kernelSource);
+
+  parser.settings.remove("openmp");
+}
 //======================================
 
 //---[ @atomic ]------------------------
@@ -0,0 +1,183 @@
+#define OCCA_TEST_PARSER_TYPE okl::threadsParser
+
+#include <occa/internal/lang/modes/threads.hpp>
+#include "../parserUtils.hpp"
+
+void testOuterLoops();
+void testTeamArgument();
+void testTeamScope();
+void testReturn();
+void testAtomic();
+
+int main(const int argc, const char **argv) {
+  parser.settings["serial/include_std"] = false;
+
+  testOuterLoops();
+  testTeamArgument();
+  testTeamScope();
+  testReturn();
+  testAtomic();
+
+  return 0;
+}
+
+#define ASSERT_IN_SOURCE(SOURCE)                      \
+  ASSERT_TRUE(parser.toString().find(SOURCE) != std::string::npos)
+
+int countInSource(const std::string &str) {
+  const std::string code = parser.toString();
+  int count = 0;
+  for (size_t pos = code.find(str);
+       pos != std::string::npos;
+       pos = code.find(str, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+//---[ @outer ]-------------------------
+void testOuterLoops() {
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 2; i < N; i += 2; @outer) {\n"
+    "      for (int k = 0; k < 4; ++k; @inner) {\n"
+    "        a[j] += i + k;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < 4; ++k; @inner) {\n"
+    "      a[j] *= 2;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  // Only outer-most @outer loops are split between threads
+  ASSERT_EQ(2, countInSource("occaOuterCount = "));
+  ASSERT_EQ(2, countInSource("occaThreads->barrier(occaThreads);"));
+  ASSERT_IN_SOURCE("int j = 0 + occaOuterIndex;");
+  ASSERT_IN_SOURCE("for (int i = 2; i < N; i += 2)");
+}
+//======================================
+
+//---[ Team ]---------------------------
+void testTeamArgument() {
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < 4; ++k; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  ASSERT_IN_SOURCE("struct occaThreadTeam_t {");
+  ASSERT_IN_SOURCE("occaThreadTeam_t * occaThreads)");
+
+  // The team is not a user argument
+  occa::lang::sourceMetadata_t metadata;
+  parser.setSourceMetadata(metadata);
+  ASSERT_EQ(2, (int) metadata.kernelsMetadata["foo"].arguments.size());
+}
+
+void testTeamScope() {
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  const int M = N + 1;\n"
+    "  a[0] = M;\n"
+    "  a[1] = M;\n"
+    "  for (int r = 0; r < 2; ++r) {\n"
+    "    a[2] = r;\n"
+    "    for (int j = 0; j < N; ++j; @outer) {\n"
+    "      for (int k = 0; k < 4; ++k; @inner) {}\n"
+    "    }\n"
+    "  }\n"
+    "  for (int r = 0; r < 2; ++r) {\n"
+    "    if (r) break;\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  // Statements outside of @outer loops are grouped and run on the first thread
+  ASSERT_EQ(3, countInSource("if (occaThreads->thread == 0)"));
+  ASSERT_EQ(1, countInSource("occaThreads->barrier(occaThreads);"));
+
+  // Locals are initialized by the first thread and copied to the team
+  ASSERT_IN_SOURCE("int M;");
+  ASSERT_IN_SOURCE("M = N + 1;");
+  ASSERT_EQ(3, countInSource("occaThreads->share(occaThreads, occaSharedValues, occaSharedBytes, 1);"));
+
+  // Initializers that can't be assigned run on every thread
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  int scale = 1;\n"
+    "  scale = 3;\n"
+    "  int values[2] = {scale, N};\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < 4; ++k; @inner) {\n"
+    "      a[j] = scale * values[0];\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  ASSERT_IN_SOURCE("int values[2] = {scale, N};");
+  ASSERT_EQ(1, countInSource("occaThreads->share(occaThreads, occaSharedValues, occaSharedBytes, 1);"));
+  ASSERT_EQ(2, countInSource("occaThreads->barrier(occaThreads);"));
+}
+
+void testReturn() {
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  if (N < 0) {\n"
+    "    a[0] = 0;\n"
+    "    return;\n"
+    "  }\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < 4; ++k; @inner) {\n"
+    "      if (k == j) return;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  // Every return and the end of the kernel leave the team
+  ASSERT_EQ(3, countInSource("occaThreads->leave(occaThreads);"));
+  ASSERT_EQ(1, countInSource("if (occaThreads->thread == 0)"));
+}
+//======================================
+
+//---[ @atomic ]------------------------
+void testAtomic() {
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < 4; ++k; @inner) {\n"
+    "      @atomic a[0] += 1;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("occaThreads->lock(occaThreads);");
+  ASSERT_IN_SOURCE("occaThreads->unlock(occaThreads);");
+
+  // The team is only available inside kernels
+  parseBadSource(
+    "void bar(float *a) {\n"
+    "  @atomic a[0] += 1;\n"
+    "}\n"
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < 4; ++k; @inner) {}\n"
+    "  }\n"
+    "}"
+  );
+}
+//======================================
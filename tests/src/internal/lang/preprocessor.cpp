@@ -17,6 +17,7 @@ void testOccaMacros();
 void testSpecialMacros();
 void testInclude();
 void testIncludeStandardHeader();
+void testIncludeOnce();
 void testPragma();
 void testOccaPragma();
 void testOccaDirective();
@@ -86,6 +87,7 @@ int main(const int argc, const char **argv) {
   testSpecialMacros();
   testInclude();
   testIncludeStandardHeader();
+  testIncludeOnce();
   testPragma();
   testOccaPragma();
   testOccaDirective();
@@ -708,6 +710,46 @@ void testIncludeStandardHeader() {
   }
 }
 
+void testIncludeOnce() {
+  const std::string guardFile = (occa::env::OCCA_DIR
+                                 + "tests/files/includeGuard.hpp");
+  const std::string onceFile = (occa::env::OCCA_DIR
+                                + "tests/files/pragmaOnce.hpp");
+
+  std::stringstream ss;
+  ss << "#include \"" << guardFile << "\"\n"
+     << "#include \"" << onceFile << "\"\n"
+     << "#include \"" << guardFile << "\"\n"
+     << "#include \"" << onceFile << "\"\n"
+     << "#undef OCCA_TEST_INCLUDE_GUARD\n"
+     << "#include \"" << guardFile << "\"\n"
+     << "5\n";
+  setStream(ss.str());
+
+  const int expectedValues[7] = {1, 2, 3, 4, 1, 2, 5};
+  for (int i = 0; i < 7; ++i) {
+    getToken();
+    while (token && (token->type() & tokenType::comment)) {
+      getToken();
+    }
+    ASSERT_EQ_BINARY(tokenType::primitive,
+                     getTokenType());
+    ASSERT_EQ(expectedValues[i],
+              (int) token->to<primitiveToken>().value);
+  }
+  while (!tokenStream.isEmpty()) {
+    getToken();
+    ASSERT_EQ_BINARY(tokenType::comment,
+                     getTokenType());
+  }
+
+  preprocessor_t &pp = *((preprocessor_t*) tokenStream.getInput("preprocessor_t"));
+  ASSERT_EQ(2,
+            (int) pp.dependencies.size());
+  ASSERT_EQ(1,
+            (int) pp.onceHeaders.size());
+}
+
 void testPragma() {
   setStream("#pragma\n");
   getToken();
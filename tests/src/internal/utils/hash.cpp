@@ -0,0 +1,68 @@
+#include <occa.hpp>
+#include <occa/internal/io.hpp>
+#include <occa/internal/utils/hash.hpp>
+#include <occa/internal/utils/testing.hpp>
+
+void testHash();
+void testIncrementalHash();
+void testHashFile();
+
+int main(const int argc, const char **argv) {
+  testHash();
+  testIncrementalHash();
+  testHashFile();
+
+  return 0;
+}
+
+void testHash() {
+  ASSERT_TRUE(occa::hash("").isInitialized());
+  ASSERT_FALSE(occa::hash_t().isInitialized());
+
+  ASSERT_EQ(occa::hash("foo"), occa::hash(std::string("foo")));
+  ASSERT_NEQ(occa::hash("foo"), occa::hash("bar"));
+
+  // Trailing bytes are padded but the length is still part of the hash
+  const char zeros[2] = {0, 0};
+  ASSERT_NEQ(occa::hash(zeros, 1), occa::hash(zeros, 2));
+  ASSERT_NEQ(occa::hash(""), occa::hash(zeros, 1));
+
+  // Every output word changes
+  const occa::hash_t a = occa::hash("occa");
+  const occa::hash_t b = occa::hash("occb");
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_NEQ(a.h[i], b.h[i]);
+  }
+
+  ASSERT_EQ(occa::hash_t::fromString(a.getFullString()), a);
+}
+
+void testIncrementalHash() {
+  std::string source;
+  for (int i = 0; i < 1000; ++i) {
+    source += occa::toString(i);
+  }
+  const occa::hash_t fullHash = occa::hash(source);
+
+  // Chunk sizes smaller, equal and larger than a stripe
+  for (int chunkBytes : {1, 7, 32, 33, 100}) {
+    occa::hasher_t hasher;
+    for (int i = 0; i < (int) source.size(); i += chunkBytes) {
+      hasher.update(source.c_str() + i,
+                    std::min(chunkBytes, (int) source.size() - i));
+    }
+    ASSERT_EQ(hasher.digest(), fullHash);
+  }
+}
+
+void testHashFile() {
+  const std::string addVectorsFile = (
+    occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+  );
+  ASSERT_EQ(occa::hashFile(addVectorsFile),
+            occa::hash(occa::io::read(addVectorsFile)));
+
+  ASSERT_THROW(
+    occa::hashFile(occa::env::OCCA_DIR + "tests/files/missing.okl");
+  );
+}
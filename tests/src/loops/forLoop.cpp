@@ -17,6 +17,10 @@ int main(const int argc, const char **argv) {
     occa::device({
       {"mode", "OpenMP"}
     }),
+    occa::device({
+      {"mode", "Threads"},
+      {"threads", 4}
+    }),
     occa::device({
       {"mode", "CUDA"},
       {"device_id", 0}
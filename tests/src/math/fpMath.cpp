@@ -107,6 +107,8 @@ int main() {
     devices.push_back(occa::device({{"mode", "Serial"}}));
   if (occa::modeIsEnabled("OpenMP"))
     devices.push_back(occa::device({{"mode", "OpenMP"}}));
+  if (occa::modeIsEnabled("Threads"))
+    devices.push_back(occa::device({{"mode", "Threads"}, {"threads", 4}}));
   if (occa::modeIsEnabled("CUDA"))
     devices.push_back(occa::device({{"mode", "CUDA"},{"device_id", 0}}));
   if (occa::modeIsEnabled("HIP"))
@@ -18,6 +18,8 @@ void testTruthyValues();
 void testComparisons();
 void testConversions();
 void testErrors();
+void testStorage();
+void testHash();
 
 int main(const int argc, const char **argv) {
   testAsTypes();
@@ -33,6 +35,8 @@ int main(const int argc, const char **argv) {
   testComparisons();
   testConversions();
   testErrors();
+  testStorage();
+  testHash();
 
   return 0;
 }
@@ -544,3 +548,130 @@ void testErrors() {
     occa::json::parse("{ a: 1}")["a"][1];
   );
 }
+
+void testStorage() {
+  occa::json j = occa::json::parse("{ c: 3, a: 1, b: { b1: 2 } }");
+
+  // Keys stay sorted
+  occa::strVector keys = j.keys();
+  ASSERT_EQ(3, (int) keys.size());
+  ASSERT_EQ("a", keys[0]);
+  ASSERT_EQ("b", keys[1]);
+  ASSERT_EQ("c", keys[2]);
+  ASSERT_EQ("{\"a\": 1, \"b\": {\"b1\": 2}, \"c\": 3}",
+            j.dump(0));
+
+  // References survive adding and removing other keys
+  occa::json &b = j["b"];
+  for (int i = 0; i < 100; ++i) {
+    j["key" + std::to_string(i)] = i;
+  }
+  j.remove("a");
+  ASSERT_EQ(2, (int) b["b1"]);
+  b["b2"] = 3;
+  ASSERT_EQ(3, j.get<int>("b/b2"));
+
+  // Assigning a child value to its parent
+  j = j["b"];
+  ASSERT_EQ(2, (int) j["b1"]);
+  ASSERT_EQ(3, (int) j["b2"]);
+  ASSERT_EQ(2, j.size());
+
+  // Changing types
+  j = "string";
+  ASSERT_TRUE(j.isString());
+  j = 1.5;
+  ASSERT_TRUE(j.isNumber());
+  ASSERT_EQ(1.5, (double) j);
+  j.asArray();
+  ASSERT_EQ(0, j.size());
+  j += 1;
+  ASSERT_EQ(1, j.size());
+
+  // Moves
+  occa::json moved = std::move(j);
+  ASSERT_TRUE(moved.isArray());
+  ASSERT_EQ(1, moved.size());
+
+  // Reading another type doesn't change the value
+  const occa::json constNumber = 2;
+  ASSERT_EQ(0, (int) constNumber.string().size());
+  ASSERT_EQ(2, (int) constNumber);
+
+  // Mutable access to another type converts the value
+  occa::json number = 2;
+  number.string() = "two";
+  ASSERT_TRUE(number.isString());
+  ASSERT_EQ("two", number.string());
+  number.object()["a"] = 1;
+  number.object()["b"] = 2;
+  ASSERT_TRUE(number.isObject());
+  ASSERT_EQ(2, (int) number.object().size());
+
+  // Unset values take the accessed type
+  occa::json unset;
+  unset.array().push_back(1);
+  ASSERT_TRUE(unset.isArray());
+  ASSERT_EQ(1, unset.size());
+
+  // Copies are deep
+  occa::json original = occa::json::parse("{ a: { b: 1 } }");
+  occa::json copy = original;
+  copy["a/b"] = 2;
+  ASSERT_EQ(1, original.get<int>("a/b"));
+  ASSERT_EQ(2, copy.get<int>("a/b"));
+  ASSERT_FALSE(original == copy);
+}
+
+void testHash() {
+  // Same values hash the same regardless of how they were built
+  occa::json j1 = occa::json::parse("{ a: 1, b: [true, 'c'], d: { e: null } }");
+  occa::json j2;
+  j2["d/e"].asNull();
+  j2["b"] = occa::jsonArray({true, "c"});
+  j2["a"] = (uint8_t) 1;
+  ASSERT_TRUE(j1.hash() == j2.hash());
+  ASSERT_TRUE(j1.hash() == occa::json(j1).hash());
+  ASSERT_TRUE(occa::hash(j1) == j1.hash());
+
+  // Structure is part of the hash
+  ASSERT_TRUE(
+    occa::json::parse("{ ab: 'c' }").hash()
+    != occa::json::parse("{ a: 'bc' }").hash()
+  );
+  ASSERT_TRUE(
+    occa::json::parse("{ a: 'b' }").hash()
+    != occa::json::parse("['a', 'b']").hash()
+  );
+  ASSERT_TRUE(
+    occa::json::parse("[[1], 2]").hash()
+    != occa::json::parse("[[1, 2]]").hash()
+  );
+  ASSERT_TRUE(
+    occa::json::parse("'1'").hash()
+    != occa::json::parse("1").hash()
+  );
+  ASSERT_TRUE(
+    occa::json::parse("-1").hash()
+    != occa::json::parse("1").hash()
+  );
+  ASSERT_TRUE(
+    occa::json::parse("1").hash()
+    != occa::json::parse("true").hash()
+  );
+  ASSERT_TRUE(
+    occa::json::parse("1.5").hash()
+    != occa::json::parse("1").hash()
+  );
+  ASSERT_TRUE(
+    occa::json().hash()
+    != occa::json::parse("null").hash()
+  );
+
+  // Unset and empty properties hash the same
+  ASSERT_TRUE(occa::json().hash() == occa::json::parse("{}").hash());
+  ASSERT_TRUE(
+    occa::json::parse("{ a: {} }").hash()
+    == occa::json({{"a", occa::json()}}).hash()
+  );
+}